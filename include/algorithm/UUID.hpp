@@ -16,60 +16,747 @@
 #include <utility>
 #include <cassert>
 #include <string>
+#include <string_view>
+#include <cstring>
+#include <stdexcept>
+#include <type_traits>
+#include <functional>
+#include <random>
+#include <chrono>
+
+#if __has_include(<compare>)
+#include <compare>
+#endif
 
 #include "algorithm/stl_extension/conversion.hpp"
+#include "algorithm/stl_extension/simd_search.hpp"
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION::SIMD::KERNEL
+{
+#if HORIZON_ALGORITHM_SIMD_X86
+    /*
+     * UUID text conversion. The 36 characters of the canonical form are handled as two 16 byte vectors and a 4 byte tail, a UUID is too
+     * small to profit from 32 byte vectors (AVX2 shuffles do not cross 128 bit lanes), so AVX2 CPUs use these kernels as well.
+     * HexToNibbles128 is shared with HexDecode (conversion.hpp).
+     */
+
+    // parses the digits of a canonical UUID string. The separators must have been checked.
+    __attribute__((target("sse4.1"))) inline bool ParseUUIDSSE41(char const* text, std::uint64_t& high, std::uint64_t& low) noexcept
+    {
+        std::int32_t tailCharacters;
+        std::memcpy(&tailCharacters, text + 32, sizeof(tailCharacters));
+
+        __m128i const first  = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text));
+        __m128i const second = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text + 16));
+        __m128i const tail   = _mm_cvtsi32_si128(tailCharacters);
+
+        // gather digits 0-15 and 16-31, dropping the separators at 8, 13, 18 and 23
+        __m128i const upperDigits = _mm_or_si128(
+                _mm_shuffle_epi8(first, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, 9, 10, 11, 12, 14, 15, -1, -1)),
+                _mm_shuffle_epi8(second, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1)));
+        __m128i const lowerDigits = _mm_or_si128(
+                _mm_shuffle_epi8(second, _mm_setr_epi8(3, 4, 5, 6, 8, 9, 10, 11, 12, 13, 14, 15, -1, -1, -1, -1)),
+                _mm_shuffle_epi8(tail, _mm_setr_epi8(-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 1, 2, 3)));
+
+        __m128i upperNibbles;
+        __m128i lowerNibbles;
+        bool const valid = HexToNibbles128(upperDigits, upperNibbles) & HexToNibbles128(lowerDigits, lowerNibbles);
+        if (!valid) return false;
+
+        // first * 16 + second for each pair of nibbles, packed to the 16 bytes in string order
+        __m128i const weights = _mm_set1_epi16(0x0110);
+        __m128i const bytes   = _mm_packus_epi16(_mm_maddubs_epi16(upperNibbles, weights), _mm_maddubs_epi16(lowerNibbles, weights));
+
+        std::uint64_t words[2];
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(words), bytes);
+        high = __builtin_bswap64(words[0]);
+        low  = __builtin_bswap64(words[1]);
+        return true;
+    }
+
+    // writes the 36 characters of the canonical form (upper case)
+    __attribute__((target("sse4.1"))) inline void FormatUUIDSSE41(std::uint64_t high, std::uint64_t low, char* buffer) noexcept
+    {
+        std::uint64_t const words[2] = { __builtin_bswap64(high), __builtin_bswap64(low) };
+
+        __m128i const bytes       = _mm_loadu_si128(reinterpret_cast<__m128i const*>(words));
+        __m128i const nibbleMask  = _mm_set1_epi8(0x0F);
+        __m128i const highNibbles = _mm_and_si128(_mm_srli_epi16(bytes, 4), nibbleMask);
+        __m128i const lowNibbles  = _mm_and_si128(bytes, nibbleMask);
+
+        __m128i const digitTable  = _mm_setr_epi8('0', '1', '2', '3', '4', '5', '6', '7', '8', '9', 'A', 'B', 'C', 'D', 'E', 'F');
+        __m128i const upperDigits = _mm_shuffle_epi8(digitTable, _mm_unpacklo_epi8(highNibbles, lowNibbles));
+        __m128i const lowerDigits = _mm_shuffle_epi8(digitTable, _mm_unpackhi_epi8(highNibbles, lowNibbles));
+
+        // spread the digits over the output and insert the separators
+        __m128i const first = _mm_or_si128(
+                _mm_shuffle_epi8(upperDigits, _mm_setr_epi8(0, 1, 2, 3, 4, 5, 6, 7, -1, 8, 9, 10, 11, -1, 12, 13)),
+                _mm_setr_epi8(0, 0, 0, 0, 0, 0, 0, 0, '-', 0, 0, 0, 0, '-', 0, 0));
+        __m128i const second = _mm_or_si128(
+                _mm_or_si128(_mm_shuffle_epi8(upperDigits, _mm_setr_epi8(14, 15, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1)),
+                             _mm_shuffle_epi8(lowerDigits, _mm_setr_epi8(-1, -1, -1, 0, 1, 2, 3, -1, 4, 5, 6, 7, 8, 9, 10, 11))),
+                _mm_setr_epi8(0, 0, '-', 0, 0, 0, 0, '-', 0, 0, 0, 0, 0, 0, 0, 0));
+
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), first);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + 16), second);
+
+        auto const tailCharacters = _mm_extract_epi32(lowerDigits, 3);
+        std::memcpy(buffer + 32, &tailCharacters, sizeof(tailCharacters));
+    }
+#endif
+}
 
 namespace HORIZON::ALGORITHM
 {
+    /*!
+     * @brief The result of parsing a UUID string.
+     */
+    enum class UUIDParseResult
+    {
+        Ok,
+        //! The string is not 36 characters long.
+        InvalidLength,
+        //! A '-' is missing at position 8, 13, 18 or 23.
+        InvalidSeparator,
+        //! A character that is not a separator is not a hex digit.
+        InvalidDigit
+    };
+
+    /*!
+     * @brief A universally unique identifier (RFC 4122).
+     * @details The 128 bits are stored as two 64 bit words (the first 8 bytes of the canonical form in the high word, most significant byte
+     * first), so a UUID is 16 bytes, trivially copyable and compared in two instructions. The string form is only created on demand.
+     */
     struct UUID
     {
+    public:
+        /*!
+         * @brief The length of the canonical string form (8-4-4-4-12 hex digits), without a terminating NUL.
+         */
+        static constexpr const size_t StringLength = 8 + 1 +
+                                                     4 + 1 +
+                                                     4 + 1 +
+                                                     4 + 1 +
+                                                     12;
+
+        /*!
+         * @brief The size of the binary form (RFC 4122 byte order, most significant byte first).
+         */
+        static constexpr const size_t ByteLength = 16;
+
     private:
-        static constexpr const size_t UUID_LENGTH     = 8 + 1 +
-                                                        4 + 1 +
-                                                        4 + 1 +
-                                                        4 + 1 +
-                                                        12;
-        static constexpr const size_t UUID_LENGTH_RAW = UUID_LENGTH - 4;
+        static constexpr const size_t DigitCount = StringLength - 4;
 
-        std::uint8_t _uuid[UUID_LENGTH_RAW]{ };
-        char         _uuidString[UUID_LENGTH]{ };
+        // version nibble in the high word, variant bits in the low word
+        static constexpr const std::uint64_t VersionMask = UINT64_C(0xF000);
+        static constexpr const std::uint64_t VariantMask = UINT64_C(0xC000000000000000);
+        static constexpr const std::uint64_t VariantRFC  = UINT64_C(0x8000000000000000);
+
+        // bits of the per thread counter of v7 UUIDs: the 12 bits of rand_a and the upper 30 bits of rand_b
+        static constexpr const unsigned V7CounterBits = 42;
+        static constexpr const unsigned V7CounterLow  = 30;
+
+        // xoshiro256**, one instance per thread
+        struct RandomEngine
+        {
+            std::uint64_t _state[4];
+
+            RandomEngine()
+            {
+                std::random_device device;
+                for (auto& word : _state)
+                    word = (static_cast<std::uint64_t>(device()) << 32u) ^ device();
+
+                // the all zero state is a fixed point
+                if ((_state[0] | _state[1] | _state[2] | _state[3]) == 0) _state[0] = UINT64_C(0x9E3779B97F4A7C15);
+            }
+
+            static constexpr std::uint64_t RotateLeft(std::uint64_t value, unsigned shift) noexcept
+            { return (value << shift) | (value >> (64u - shift)); }
+
+            inline std::uint64_t Next() noexcept
+            {
+                auto const result = RotateLeft(_state[1] * 5, 7) * 9;
+                auto const t      = _state[1] << 17u;
+
+                _state[2] ^= _state[0];
+                _state[3] ^= _state[1];
+                _state[1] ^= _state[2];
+                _state[0] ^= _state[3];
+                _state[2] ^= t;
+                _state[3] = RotateLeft(_state[3], 45);
+
+                return result;
+            }
+        };
+
+        std::uint64_t _high = 0;
+        std::uint64_t _low  = 0;
 
     public:
         static UUID const Nil;
 
     public:
-        template<size_t N = UUID_LENGTH>
-        constexpr explicit UUID(char const (& uuid)[N])
+        /*!
+         * @brief Creates the nil UUID.
+         */
+        constexpr UUID() noexcept = default;
+
+        /*!
+         * @brief Creates a UUID from its two words.
+         * @param high  The first 8 bytes, most significant byte first.
+         * @param low   The last 8 bytes, most significant byte first.
+         */
+        constexpr UUID(std::uint64_t high, std::uint64_t low) noexcept :
+                _high(high),
+                _low(low)
+        { }
+
+        /*!
+         * @brief Creates a UUID from a string literal in canonical form.
+         * @details In a constant expression (e.g. a constexpr variable), a malformed literal is a compile error.
+         * @throws std::invalid_argument If the literal is malformed.
+         */
+        template<size_t N>
+        constexpr explicit UUID(char const (& uuid)[N]) :
+                UUID(FromString(std::string_view(uuid, N - 1)))
+        {
+            static_assert(N == StringLength + 1, "A UUID literal has 36 characters (8-4-4-4-12 hex digits)");
+        }
+
+        /*!
+         * @brief Creates a UUID from its canonical form.
+         * @details Usable in constant expressions, a malformed string is then a compile error. Use Parse to validate untrusted input at runtime
+         * without exceptions.
+         * @param text The string, exactly 36 characters (8-4-4-4-12 hex digits).
+         * @return The UUID.
+         * @throws std::invalid_argument If the string is malformed.
+         */
+        static constexpr UUID FromString(std::string_view text)
+        {
+            UUID uuid;
+            if (CheckLayout(text) != UUIDParseResult::Ok || ParseDigits(text.data(), uuid) != UUIDParseResult::Ok)
+                throw std::invalid_argument("Malformed UUID string");
+            return uuid;
+        }
+
+        /*!
+         * @return The first 8 bytes, most significant byte first.
+         */
+        [[nodiscard]] constexpr std::uint64_t High() const noexcept
+        { return _high; }
+
+        /*!
+         * @return The last 8 bytes, most significant byte first.
+         */
+        [[nodiscard]] constexpr std::uint64_t Low() const noexcept
+        { return _low; }
+
+        /*!
+         * @return The version field (4 for random, 7 for time ordered UUIDs).
+         */
+        [[nodiscard]] constexpr unsigned Version() const noexcept
+        { return static_cast<unsigned>((_high & VersionMask) >> 12u); }
+
+        /*!
+         * @return The two variant bits (2 for RFC 4122 UUIDs).
+         */
+        [[nodiscard]] constexpr unsigned Variant() const noexcept
+        { return static_cast<unsigned>(_low >> 62u); }
+
+        /*!
+         * @brief Creates a random (version 4) UUID.
+         * @details Uses a per thread xoshiro256** generator seeded from std::random_device on first use. Lock free.
+         * @note The generator is fast, not cryptographically secure. Do not use the result as a secret.
+         */
+        static UUID GenerateV4() noexcept
         {
-            // TODO: check length?
-            // assert(N == UUID_LENGTH);
-            // assert(uuid[8] == uuid[8 + 1 + 4] == uuid[8 + 1 + 4 + 1 + 4] == uuid[8 + 1 + 4 + 1 + 4 + 1 + 4] == '-');
+            auto& random = ThreadRandom();
+
+            auto const high = random.Next();
+            auto const low  = random.Next();
+            return UUID((high & ~VersionMask) | (UINT64_C(4) << 12u), (low & ~VariantMask) | VariantRFC);
+        }
 
-            for (size_t i = 0, k = 0; i < N; ++i)
+        /*!
+         * @brief Creates a time ordered (version 7) UUID.
+         * @details The first 48 bits are the unix time in milliseconds, so UUIDs sort by creation time (at millisecond resolution across
+         * threads). Within a millisecond, a per thread 42 bit counter starting at a random value keeps the UUIDs of one thread strictly
+         * increasing; if it overflows, the timestamp is advanced by one. The remaining 32 bits are random. Lock free.
+         * @note The generator is fast, not cryptographically secure. Do not use the result as a secret.
+         */
+        static UUID GenerateV7() noexcept
+        {
+            struct State
             {
-                _uuidString[i] = STL_EXTENSION::ToUpper(uuid[i]);
+                std::uint64_t _millisecond = 0;
+                std::uint64_t _counter     = 0;
+            };
+
+            thread_local State state;
+            auto& random = ThreadRandom();
 
-                // skip - characters during hex conversion
-                if (uuid[i] == '-') continue;
+            auto const now = static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                    std::chrono::system_clock::now().time_since_epoch()).count());
 
-                // convert to number
-                _uuid[k++] = STL_EXTENSION::HexCharToByte(uuid[i]);
+            // start a new millisecond with the top counter bit cleared, leaving room for 2^41 increments
+            if (now > state._millisecond)
+            {
+                state._millisecond = now;
+                state._counter     = random.Next() >> (64u - V7CounterBits + 1u);
             }
+            else if ((++state._counter >> V7CounterBits) != 0)
+            {
+                ++state._millisecond;
+                state._counter = random.Next() >> (64u - V7CounterBits + 1u);
+            }
+
+            auto const counter = state._counter;
+            auto const high    = ((state._millisecond & UINT64_C(0xFFFFFFFFFFFF)) << 16u) | (UINT64_C(7) << 12u) | (counter >> V7CounterLow);
+            auto const low     = VariantRFC |
+                                 ((counter & ((UINT64_C(1) << V7CounterLow) - 1)) << 32u) |
+                                 (random.Next() >> 32u);
+            return UUID(high, low);
         }
 
         [[nodiscard]] constexpr bool Equals(UUID const& other) const noexcept
+        { return _high == other._high && _low == other._low; }
+
+        /*!
+         * @brief Compares two UUIDs in the byte order of their canonical form (the order of their string representations).
+         * @return A negative value if this is less than @p other, 0 if they are equal, a positive value otherwise.
+         */
+        [[nodiscard]] constexpr int Compare(UUID const& other) const noexcept
+        {
+            if (_high != other._high) return _high < other._high ? -1 : 1;
+            if (_low != other._low) return _low < other._low ? -1 : 1;
+            return 0;
+        }
+
+        /*!
+         * @brief A 64 bit hash of the UUID.
+         * @details Both words are folded and mixed (the finalizer of SplitMix64), so UUIDs that only differ in a few bits, e.g. time ordered
+         * UUIDs created in sequence, still spread over all hash bits.
+         */
+        [[nodiscard]] constexpr std::uint64_t Hash() const noexcept
         {
-            for (size_t i = 0; i < UUID_LENGTH_RAW; ++i) { if (_uuid[i] != other._uuid[i]) return false; }
-            return true;
+            std::uint64_t hash = _high ^ (_low * UINT64_C(0x9E3779B97F4A7C15));
+            hash = (hash ^ (hash >> 30u)) * UINT64_C(0xBF58476D1CE4E5B9);
+            hash = (hash ^ (hash >> 27u)) * UINT64_C(0x94D049BB133111EB);
+            return hash ^ (hash >> 31u);
         }
 
         constexpr bool operator==(UUID const& other) const noexcept
         { return Equals(other); }
 
-        explicit operator std::string() const noexcept
-        { return std::string(_uuidString); }
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+        constexpr std::strong_ordering operator<=>(UUID const& other) const noexcept
+        { return Compare(other) <=> 0; }
+#else
+        constexpr bool operator!=(UUID const& other) const noexcept
+        { return !Equals(other); }
+
+        constexpr bool operator<(UUID const& other) const noexcept
+        { return Compare(other) < 0; }
+
+        constexpr bool operator<=(UUID const& other) const noexcept
+        { return Compare(other) <= 0; }
+
+        constexpr bool operator>(UUID const& other) const noexcept
+        { return Compare(other) > 0; }
+
+        constexpr bool operator>=(UUID const& other) const noexcept
+        { return Compare(other) >= 0; }
+#endif
+
+        /*!
+         * @brief Writes the canonical string form (upper case) into a buffer.
+         * @param buffer The buffer. Must hold at least StringLength characters, no terminating NUL is written.
+         * @return A pointer past the last written character.
+         */
+        constexpr char* Format(char* buffer) const noexcept
+        {
+            constexpr char const digits[] = "0123456789ABCDEF";
+
+            for (size_t i = 0, k = 0; i < StringLength; ++i)
+            {
+                if (i == 8 || i == 13 || i == 18 || i == 23)
+                {
+                    buffer[i] = '-';
+                    continue;
+                }
+
+                auto const word  = k < DigitCount / 2 ? _high : _low;
+                auto const shift = 60u - 4u * static_cast<unsigned>(k++ % (DigitCount / 2));
+                buffer[i] = digits[(word >> shift) & 0xFu];
+            }
+
+            return buffer + StringLength;
+        }
+
+        explicit operator std::string() const
+        {
+            std::string result(StringLength, '\0');
+            Format(result.data());
+            return result;
+        }
+
+        /*!
+         * @brief Parses the canonical form of a UUID.
+         * @details Upper and lower case hex digits are accepted. Uses SSE4.1 if the CPU supports it (@sa STL_EXTENSION::SIMD::DetectSimdLevel).
+         * @param text  The string, exactly 36 characters (8-4-4-4-12 hex digits).
+         * @param uuid  Receives the UUID. Unchanged if the string is malformed.
+         * @return Ok or the reason the string was rejected.
+         */
+        [[nodiscard]] static UUIDParseResult Parse(std::string_view text, UUID& uuid) noexcept
+        { return ParseCanonical(text, uuid, STL_EXTENSION::SIMD::DetectSimdLevel()); }
+
+        /*!
+         * @brief Parses an array of strings.
+         * @param texts     The strings.
+         * @param count     The number of strings.
+         * @param uuids     Receives the UUIDs, @p count elements. Malformed strings result in Nil.
+         * @param results   Optional, receives the result of each string, @p count elements.
+         * @return The number of strings parsed successfully.
+         */
+        static std::size_t ParseBatch(std::string_view const* texts, std::size_t count, UUID* uuids, UUIDParseResult* results = nullptr) noexcept
+        {
+            auto const level = STL_EXTENSION::SIMD::DetectSimdLevel();
+
+            std::size_t parsed = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uuids[i] = UUID();
+                auto const result = ParseCanonical(texts[i], uuids[i], level);
+
+                parsed += result == UUIDParseResult::Ok;
+                if (results) results[i] = result;
+            }
+            return parsed;
+        }
+
+        /*!
+         * @brief Writes the canonical string forms (upper case) of an array of UUIDs back to back.
+         * @param uuids     The UUIDs.
+         * @param count     The number of UUIDs.
+         * @param buffer    The buffer. Must hold at least count * StringLength characters, no separators or NULs are written.
+         * @return A pointer past the last written character.
+         */
+        static char* FormatBatch(UUID const* uuids, std::size_t count, char* buffer) noexcept
+        {
+#if HORIZON_ALGORITHM_SIMD_X86
+            if (STL_EXTENSION::SIMD::DetectSimdLevel() >= STL_EXTENSION::SIMD::SimdLevel::SSE41)
+            {
+                for (std::size_t i = 0; i < count; ++i, buffer += StringLength)
+                    STL_EXTENSION::SIMD::KERNEL::FormatUUIDSSE41(uuids[i]._high, uuids[i]._low, buffer);
+                return buffer;
+            }
+#endif
+            for (std::size_t i = 0; i < count; ++i) buffer = uuids[i].Format(buffer);
+            return buffer;
+        }
+
+        /*!
+         * @brief Writes the binary form (RFC 4122 byte order).
+         * @param bytes The buffer. Must hold at least ByteLength bytes, no alignment required.
+         */
+        void Encode(void* bytes) const noexcept
+        {
+            StoreBigEndian(bytes, _high);
+            StoreBigEndian(static_cast<unsigned char*>(bytes) + 8, _low);
+        }
+
+        /*!
+         * @brief Reads the binary form (RFC 4122 byte order).
+         * @param bytes The buffer. Must hold at least ByteLength bytes, no alignment required.
+         * @return The UUID.
+         */
+        [[nodiscard]] static UUID Decode(void const* bytes) noexcept
+        { return UUID(LoadBigEndian(bytes), LoadBigEndian(static_cast<unsigned char const*>(bytes) + 8)); }
+
+        /*!
+         * @brief Writes the binary forms of an array of UUIDs back to back.
+         * @param uuids The UUIDs.
+         * @param count The number of UUIDs.
+         * @param bytes The buffer. Must hold at least count * ByteLength bytes.
+         */
+        static void EncodeBatch(UUID const* uuids, std::size_t count, void* bytes) noexcept
+        {
+            auto* output = static_cast<unsigned char*>(bytes);
+            for (std::size_t i = 0; i < count; ++i, output += ByteLength) uuids[i].Encode(output);
+        }
+
+        /*!
+         * @brief Reads an array of binary UUIDs stored back to back.
+         * @param bytes The buffer. Must hold at least count * ByteLength bytes.
+         * @param count The number of UUIDs.
+         * @param uuids Receives the UUIDs, @p count elements.
+         */
+        static void DecodeBatch(void const* bytes, std::size_t count, UUID* uuids) noexcept
+        {
+            auto const* input = static_cast<unsigned char const*>(bytes);
+            for (std::size_t i = 0; i < count; ++i, input += ByteLength) uuids[i] = Decode(input);
+        }
+
+    private:
+        static constexpr std::uint64_t ByteSwap(std::uint64_t value) noexcept
+        {
+#if defined(__GNUC__) || defined(__clang__)
+            return __builtin_bswap64(value);
+#else
+            std::uint64_t result = 0;
+            for (unsigned i = 0; i < 8; ++i, value >>= 8u) result = (result << 8u) | (value & 0xFFu);
+            return result;
+#endif
+        }
+
+        // unaligned big endian access. The loops in EncodeBatch/DecodeBatch vectorise to byte shuffles.
+        static std::uint64_t LoadBigEndian(void const* bytes) noexcept
+        {
+            std::uint64_t value;
+            std::memcpy(&value, bytes, sizeof(value));
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+            return value;
+#else
+            return ByteSwap(value);
+#endif
+        }
+
+        static void StoreBigEndian(void* bytes, std::uint64_t value) noexcept
+        {
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ != __ORDER_BIG_ENDIAN__)
+            value = ByteSwap(value);
+#endif
+            std::memcpy(bytes, &value, sizeof(value));
+        }
+
+        // the value of a hex digit or 0xFF
+        static constexpr std::uint8_t HexDigitValue(char character) noexcept
+        {
+            if ((character >= '0') && (character <= '9')) return static_cast<std::uint8_t>(character - '0');
+            if ((character >= 'a') && (character <= 'f')) return static_cast<std::uint8_t>(character - 'a' + 10);
+            if ((character >= 'A') && (character <= 'F')) return static_cast<std::uint8_t>(character - 'A' + 10);
+            return 0xFF;
+        }
+
+        // checks the length and the separators of the canonical form
+        static constexpr UUIDParseResult CheckLayout(std::string_view text) noexcept
+        {
+            if (text.size() != StringLength) return UUIDParseResult::InvalidLength;
+            if (text[8] != '-' || text[13] != '-' || text[18] != '-' || text[23] != '-') return UUIDParseResult::InvalidSeparator;
+            return UUIDParseResult::Ok;
+        }
+
+        // parses the digits of a string with a checked layout
+        static constexpr UUIDParseResult ParseDigits(char const* characters, UUID& uuid) noexcept
+        {
+            std::uint64_t words[2]{};
+            for (size_t i = 0, k = 0; i < StringLength; ++i)
+            {
+                if (i == 8 || i == 13 || i == 18 || i == 23) continue;
+
+                auto const value = HexDigitValue(characters[i]);
+                if (value > 0xF) return UUIDParseResult::InvalidDigit;
+
+                auto& word = words[k++ / (DigitCount / 2)];
+                word = (word << 4u) | value;
+            }
+
+            uuid._high = words[0];
+            uuid._low  = words[1];
+            return UUIDParseResult::Ok;
+        }
+
+        static UUIDParseResult ParseCanonical(std::string_view text, UUID& uuid, [[maybe_unused]] STL_EXTENSION::SIMD::SimdLevel level) noexcept
+        {
+            auto const layout = CheckLayout(text);
+            if (layout != UUIDParseResult::Ok) return layout;
+
+#if HORIZON_ALGORITHM_SIMD_X86
+            if (level >= STL_EXTENSION::SIMD::SimdLevel::SSE41)
+            {
+                return STL_EXTENSION::SIMD::KERNEL::ParseUUIDSSE41(text.data(), uuid._high, uuid._low) ? UUIDParseResult::Ok
+                                                                                                         : UUIDParseResult::InvalidDigit;
+            }
+#endif
+            return ParseDigits(text.data(), uuid);
+        }
+
+        static RandomEngine& ThreadRandom()
+        {
+            thread_local RandomEngine engine;
+            return engine;
+        }
+    };
+
+    static_assert(sizeof(UUID) == 16, "UUID must be packed into 16 bytes");
+    static_assert(std::is_trivially_copyable_v<UUID>, "UUID must be trivially copyable");
+
+    inline constexpr UUID const UUID::Nil{ };
+
+    /*!
+     * @brief A non-owning view of a binary UUID (16 bytes in RFC 4122 byte order), e.g. a field in a network or file buffer.
+     * @details Compares, orders and hashes like the UUID it refers to, so UUIDs can be compared with and looked up by views without copying
+     * or parsing. The bytes are read on every access, the buffer must outlive the view.
+     */
+    class UUIDView
+    {
+    private:
+        unsigned char const* _bytes;
+
+    public:
+        /*!
+         * @param bytes The first of UUID::ByteLength bytes. No alignment required.
+         */
+        explicit UUIDView(void const* bytes) noexcept :
+                _bytes(static_cast<unsigned char const*>(bytes))
+        { }
+
+        /*!
+         * @return The viewed bytes.
+         */
+        [[nodiscard]] inline unsigned char const* Data() const noexcept
+        { return _bytes; }
+
+        /*!
+         * @return A copy of the viewed UUID.
+         */
+        [[nodiscard]] inline UUID ToUUID() const noexcept
+        { return UUID::Decode(_bytes); }
+
+        [[nodiscard]] inline std::uint64_t High() const noexcept
+        { return ToUUID().High(); }
+
+        [[nodiscard]] inline std::uint64_t Low() const noexcept
+        { return ToUUID().Low(); }
+
+        /*!
+         * @copydoc UUID::Hash
+         */
+        [[nodiscard]] inline std::uint64_t Hash() const noexcept
+        { return ToUUID().Hash(); }
+
+        [[nodiscard]] inline bool Equals(UUID const& other) const noexcept
+        { return ToUUID().Equals(other); }
+
+        [[nodiscard]] inline bool Equals(UUIDView const& other) const noexcept
+        { return _bytes == other._bytes || std::memcmp(_bytes, other._bytes, UUID::ByteLength) == 0; }
+
+        /*!
+         * @copydoc UUID::Compare
+         */
+        [[nodiscard]] inline int Compare(UUID const& other) const noexcept
+        { return ToUUID().Compare(other); }
+
+        [[nodiscard]] inline int Compare(UUIDView const& other) const noexcept
+        {
+            // the bytes are big endian, so the byte wise comparison is the order of the UUIDs
+            auto const result = std::memcmp(_bytes, other._bytes, UUID::ByteLength);
+            return (result > 0) - (result < 0);
+        }
+
+        inline bool operator==(UUIDView const& other) const noexcept
+        { return Equals(other); }
+
+        inline bool operator==(UUID const& other) const noexcept
+        { return Equals(other); }
+
+#if defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison)
+        inline std::strong_ordering operator<=>(UUIDView const& other) const noexcept
+        { return Compare(other) <=> 0; }
+
+        inline std::strong_ordering operator<=>(UUID const& other) const noexcept
+        { return Compare(other) <=> 0; }
+#else
+        inline bool operator!=(UUIDView const& other) const noexcept
+        { return !Equals(other); }
+
+        inline bool operator!=(UUID const& other) const noexcept
+        { return !Equals(other); }
+
+        inline bool operator<(UUIDView const& other) const noexcept
+        { return Compare(other) < 0; }
+
+        inline bool operator<(UUID const& other) const noexcept
+        { return Compare(other) < 0; }
+
+        inline bool operator<=(UUIDView const& other) const noexcept
+        { return Compare(other) <= 0; }
+
+        inline bool operator<=(UUID const& other) const noexcept
+        { return Compare(other) <= 0; }
+
+        inline bool operator>(UUIDView const& other) const noexcept
+        { return Compare(other) > 0; }
+
+        inline bool operator>(UUID const& other) const noexcept
+        { return Compare(other) > 0; }
+
+        inline bool operator>=(UUIDView const& other) const noexcept
+        { return Compare(other) >= 0; }
+
+        inline bool operator>=(UUID const& other) const noexcept
+        { return Compare(other) >= 0; }
+#endif
+    };
+
+#if !(defined(__cpp_impl_three_way_comparison) && defined(__cpp_lib_three_way_comparison))
+    // UUID on the left hand side. C++20 rewrites these from the members of UUIDView.
+    inline bool operator==(UUID const& uuid, UUIDView const& view) noexcept
+    { return view == uuid; }
+
+    inline bool operator!=(UUID const& uuid, UUIDView const& view) noexcept
+    { return view != uuid; }
+
+    inline bool operator<(UUID const& uuid, UUIDView const& view) noexcept
+    { return view > uuid; }
+
+    inline bool operator<=(UUID const& uuid, UUIDView const& view) noexcept
+    { return view >= uuid; }
+
+    inline bool operator>(UUID const& uuid, UUIDView const& view) noexcept
+    { return view < uuid; }
+
+    inline bool operator>=(UUID const& uuid, UUIDView const& view) noexcept
+    { return view <= uuid; }
+#endif
+
+    inline namespace LITERALS
+    {
+        /*!
+         * @brief Creates a UUID from a string literal in canonical form, e.g. "123e4567-e89b-12d3-a456-426614174000"_uuid.
+         * @details The length, the separators and the hex digits are validated at compile time: a malformed literal does not compile. Before
+         * C++20 this requires a constant expression context, e.g. a constexpr variable; otherwise a malformed literal throws at runtime.
+         * @throws std::invalid_argument If the literal is malformed (only at runtime, before C++20).
+         */
+#if defined(__cpp_consteval)
+        consteval UUID operator ""_uuid(char const* text, std::size_t length)
+#else
+        constexpr UUID operator ""_uuid(char const* text, std::size_t length)
+#endif
+        { return UUID::FromString(std::string_view(text, length)); }
+    }
+}
+
+namespace std
+{
+    /*!
+     * @brief Hashes a UUID with HORIZON::ALGORITHM::UUID::Hash.
+     */
+    template<>
+    struct hash<HORIZON::ALGORITHM::UUID>
+    {
+        inline size_t operator()(HORIZON::ALGORITHM::UUID const& uuid) const noexcept
+        { return static_cast<size_t>(uuid.Hash()); }
     };
 
-    // TODO: make that a constexpr
-    inline UUID const UUID::Nil{ "00000000-0000-0000-0000-000000000000" };
-}
\ No newline at end of file
+    /*!
+     * @brief Hashes a UUIDView like the UUID it refers to.
+     */
+    template<>
+    struct hash<HORIZON::ALGORITHM::UUIDView>
+    {
+        inline size_t operator()(HORIZON::ALGORITHM::UUIDView const& view) const noexcept
+        { return static_cast<size_t>(view.Hash()); }
+    };
+}
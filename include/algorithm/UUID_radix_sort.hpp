@@ -0,0 +1,325 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 22:10
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <vector>
+#include <array>
+#include <memory>
+#include <algorithm>
+#include <atomic>
+#include <thread>
+#include <utility>
+#include <functional>
+#include <type_traits>
+
+#include "algorithm/UUID.hpp"
+
+namespace HORIZON::ALGORITHM
+{
+    namespace RADIX
+    {
+        // marks the sorts without payload
+        struct NoPayload
+        { };
+
+        // below this size, buckets are insertion sorted
+        static constexpr const std::size_t InsertionSortLimit = 32;
+
+        // below this size per thread, the threads cost more than they save
+        static constexpr const std::size_t ParallelMinimum = 1u << 16u;
+
+        static constexpr const unsigned DigitBits  = 8;
+        static constexpr const unsigned DigitCount = 128 / DigitBits;
+        static constexpr const unsigned Radix      = 1u << DigitBits;
+
+        using histogram_type = std::array<std::size_t, Radix>;
+
+        // digit 0 is the least significant byte of the low word
+        inline unsigned Digit(UUID const& uuid, unsigned digit) noexcept
+        {
+            auto const word = digit < DigitCount / 2 ? uuid.Low() : uuid.High();
+            return static_cast<unsigned>(word >> (DigitBits * (digit % (DigitCount / 2)))) & (Radix - 1);
+        }
+
+        // the most significant digit in which the UUIDs differ, or -1 if all are equal
+        inline int FirstDistinctDigit(UUID const* uuids, std::size_t count) noexcept
+        {
+            if (count < 2) return -1;
+
+            auto const [minimum, maximum] = std::minmax_element(uuids, uuids + count);
+            for (int digit = DigitCount - 1; digit >= 0; --digit)
+            {
+                if (Digit(*minimum, digit) != Digit(*maximum, digit)) return digit;
+            }
+            return -1;
+        }
+
+        // stable
+        template<typename Payload>
+        void InsertionSort(UUID* uuids, Payload* payload, std::size_t count)
+        {
+            for (std::size_t i = 1; i < count; ++i)
+            {
+                auto const uuid = uuids[i];
+                if (!(uuid < uuids[i - 1])) continue;
+
+                Payload item{ };
+                if constexpr (!std::is_same_v<Payload, NoPayload>) item = std::move(payload[i]);
+
+                auto j = i;
+                for (; j > 0 && uuid < uuids[j - 1]; --j)
+                {
+                    uuids[j] = uuids[j - 1];
+                    if constexpr (!std::is_same_v<Payload, NoPayload>) payload[j] = std::move(payload[j - 1]);
+                }
+
+                uuids[j] = uuid;
+                if constexpr (!std::is_same_v<Payload, NoPayload>) payload[j] = std::move(item);
+            }
+        }
+
+        template<typename Payload>
+        void MoveRange(UUID* fromUUIDs, Payload* fromPayload, std::size_t count, UUID* toUUIDs, Payload* toPayload)
+        {
+            std::copy(fromUUIDs, fromUUIDs + count, toUUIDs);
+            if constexpr (!std::is_same_v<Payload, NoPayload>) std::move(fromPayload, fromPayload + count, toPayload);
+        }
+
+        template<typename Payload>
+        Payload* Offset(Payload* payload, std::size_t offset) noexcept
+        {
+            if constexpr (std::is_same_v<Payload, NoPayload>) return payload;
+            else return payload + offset;
+        }
+
+        /*
+         * Stable MSD radix sort of [uuids, uuids + count) by the digits <= digit (the more significant ones must be equal). Scatters into the
+         * buffers by the first digit in which the UUIDs differ, sorts each bucket recursively (with the roles of the arrays swapped) and
+         * moves it back. Digits equal for all UUIDs of a bucket are skipped, so random UUIDs need about log256(count) levels, and small
+         * buckets are insertion sorted while they are in cache.
+         */
+        template<typename Payload>
+        void MsdSort(UUID* uuids, UUID* buffer, Payload* payload, Payload* payloadBuffer, std::size_t count, int digit)
+        {
+            if (count <= InsertionSortLimit) return InsertionSort(uuids, payload, count);
+
+            histogram_type histogram;
+            for (;; --digit)
+            {
+                if (digit < 0) return;
+
+                histogram.fill(0);
+                for (std::size_t i = 0; i < count; ++i) ++histogram[Digit(uuids[i], digit)];
+                if (histogram[Digit(uuids[0], digit)] != count) break;
+            }
+
+            // exclusive prefix sum: the first output index of each digit
+            histogram_type begin;
+            std::size_t    offset = 0;
+            for (unsigned bucket = 0; bucket < Radix; ++bucket)
+            {
+                begin[bucket] = offset;
+                offset += histogram[bucket];
+            }
+
+            auto next = begin;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                auto const target = next[Digit(uuids[i], digit)]++;
+                buffer[target] = uuids[i];
+                if constexpr (!std::is_same_v<Payload, NoPayload>) payloadBuffer[target] = std::move(payload[i]);
+            }
+
+            for (unsigned bucket = 0; bucket < Radix; ++bucket)
+            {
+                auto const first = begin[bucket];
+                auto const size  = histogram[bucket];
+                if (size == 0) continue;
+
+                MsdSort(buffer + first, uuids + first, Offset(payloadBuffer, first), Offset(payload, first), size, digit - 1);
+                MoveRange(buffer + first, Offset(payloadBuffer, first), size, uuids + first, Offset(payload, first));
+            }
+        }
+
+        template<typename Payload>
+        void SortSerial(UUID* uuids, Payload* payload, std::size_t count)
+        {
+            if (count <= InsertionSortLimit) return InsertionSort(uuids, payload, count);
+
+            std::vector<UUID>    buffer(count);
+            std::vector<Payload> payloadBuffer(std::is_same_v<Payload, NoPayload> ? 0 : count);
+
+            MsdSort(uuids, buffer.data(), payload, payloadBuffer.data(), count, DigitCount - 1);
+        }
+
+        /*
+         * The first level of MsdSort split over the threads (per thread histograms, stable scatter into the buffer), followed by the
+         * recursive sorts of the 256 buckets, which the threads take from a shared counter. The first level uses the first digit in which the
+         * minimum and the maximum differ, so UUIDs with a common prefix (e.g. time ordered ones) still spread over the buckets.
+         */
+        template<typename Payload>
+        void SortParallel(UUID* uuids, Payload* payload, std::size_t count, unsigned threadCount)
+        {
+            auto const digit = FirstDistinctDigit(uuids, count);
+            if (digit < 0) return;
+
+            std::vector<UUID>    buffer(count);
+            std::vector<Payload> payloadBuffer(std::is_same_v<Payload, NoPayload> ? 0 : count);
+
+            std::vector<histogram_type>        offsets(threadCount);
+            std::array<std::size_t, Radix + 1> bucketBegin{ };
+
+            auto const chunk = (count + threadCount - 1) / threadCount;
+            auto runThreads = [threadCount](auto&& work)
+            {
+                std::vector<std::thread> threads;
+                threads.reserve(threadCount - 1);
+                for (unsigned thread = 1; thread < threadCount; ++thread) threads.emplace_back(std::ref(work), thread);
+                work(0);
+                for (auto& thread : threads) thread.join();
+            };
+
+            runThreads([&](unsigned thread)
+                       {
+                           auto& histogram = offsets[thread];
+                           histogram.fill(0);
+
+                           auto const end = std::min(count, (thread + 1) * chunk);
+                           for (std::size_t i = thread * chunk; i < end; ++i) ++histogram[Digit(uuids[i], digit)];
+                       });
+
+            // chunk t of bucket b starts after bucket b of all chunks < t: keeps the scatter stable
+            std::size_t offset = 0;
+            for (unsigned bucket = 0; bucket < Radix; ++bucket)
+            {
+                bucketBegin[bucket] = offset;
+                for (unsigned thread = 0; thread < threadCount; ++thread)
+                {
+                    auto const size = offsets[thread][bucket];
+                    offsets[thread][bucket] = offset;
+                    offset += size;
+                }
+            }
+            bucketBegin[Radix] = count;
+
+            runThreads([&](unsigned thread)
+                       {
+                           auto& next = offsets[thread];
+
+                           auto const end = std::min(count, (thread + 1) * chunk);
+                           for (std::size_t i = thread * chunk; i < end; ++i)
+                           {
+                               auto const target = next[Digit(uuids[i], digit)]++;
+                               buffer[target] = uuids[i];
+                               if constexpr (!std::is_same_v<Payload, NoPayload>) payloadBuffer[target] = std::move(payload[i]);
+                           }
+                       });
+
+            std::atomic<unsigned> nextBucket{ 0 };
+            runThreads([&](unsigned)
+                       {
+                           for (auto bucket = nextBucket++; bucket < Radix; bucket = nextBucket++)
+                           {
+                               auto const first = bucketBegin[bucket];
+                               auto const size  = bucketBegin[bucket + 1] - first;
+                               if (size == 0) continue;
+
+                               auto* const bucketPayload       = Offset(payload, first);
+                               auto* const bucketPayloadBuffer = Offset(payloadBuffer.data(), first);
+
+                               MsdSort(buffer.data() + first, uuids + first, bucketPayloadBuffer, bucketPayload, size, digit - 1);
+                               MoveRange(buffer.data() + first, bucketPayloadBuffer, size, uuids + first, bucketPayload);
+                           }
+                       });
+        }
+
+        template<typename Payload>
+        void Sort(UUID* uuids, Payload* payload, std::size_t count, unsigned threadCount)
+        {
+            threadCount = static_cast<unsigned>(std::min<std::size_t>(std::max(1u, threadCount), count / ParallelMinimum));
+
+            if (threadCount <= 1) SortSerial(uuids, payload, count);
+            else SortParallel(uuids, payload, count, threadCount);
+        }
+    }
+
+
+    /*!
+     * @brief Sorts an array of UUIDs with a radix sort.
+     * @details A most significant digit first radix sort by the 16 bytes of the UUIDs (the order of operator<), one byte per level. Bytes
+     * that are equal for all UUIDs of a bucket are skipped, small buckets are insertion sorted. Needs a buffer of the size of the array.
+     *
+     * With more than one thread, the first level is split over the threads and the resulting 256 buckets are sorted in parallel. The first
+     * level uses the first byte in which the UUIDs differ, but skewed data (e.g. time ordered UUIDs spanning a few seconds) may still fill
+     * only some of the buckets and limit the parallelism.
+     *
+     * @param uuids         The UUIDs.
+     * @param count         The number of UUIDs.
+     * @param threadCount   The maximum number of threads (including the calling thread). Use std::thread::hardware_concurrency() for all.
+     */
+    inline void RadixSort(UUID* uuids, std::size_t count, unsigned threadCount = 1)
+    { RADIX::Sort<RADIX::NoPayload>(uuids, nullptr, count, threadCount); }
+
+    /*!
+     * @brief Sorts an array of UUIDs and permutes a payload array the same way.
+     * @details The sort is stable: payloads of equal UUIDs keep their order. @copydetails RadixSort(UUID*, std::size_t, unsigned)
+     *
+     * @tparam Payload      The payload type, e.g. a row index. Must be default constructible and move assignable.
+     * @param uuids         The UUIDs.
+     * @param payload       The payload of each UUID, @p count elements.
+     * @param count         The number of UUIDs.
+     * @param threadCount   The maximum number of threads (including the calling thread).
+     */
+    template<typename Payload>
+    void RadixSort(UUID* uuids, Payload* payload, std::size_t count, unsigned threadCount = 1)
+    { RADIX::Sort(uuids, payload, count, threadCount); }
+
+    /*!
+     * @brief Removes consecutive duplicates from a sorted array of UUIDs in a single pass.
+     * @param uuids The UUIDs, sorted (e.g. with RadixSort).
+     * @param count The number of UUIDs.
+     * @return The number of unique UUIDs, which are moved to the front of the array.
+     */
+    inline std::size_t Unique(UUID* uuids, std::size_t count) noexcept
+    { return static_cast<std::size_t>(std::unique(uuids, uuids + count) - uuids); }
+
+    /*!
+     * @brief Removes consecutive duplicates from a sorted array of UUIDs and their payloads in a single pass.
+     * @details The payload of the first occurrence of each UUID is kept.
+     * @param uuids     The UUIDs, sorted (e.g. with RadixSort).
+     * @param payload   The payload of each UUID, @p count elements.
+     * @param count     The number of UUIDs.
+     * @return The number of unique UUIDs, which are moved to the front of both arrays.
+     */
+    template<typename Payload>
+    std::size_t Unique(UUID* uuids, Payload* payload, std::size_t count)
+    {
+        if (count == 0) return 0;
+
+        std::size_t result = 1;
+        for (std::size_t i = 1; i < count; ++i)
+        {
+            if (uuids[i] == uuids[result - 1]) continue;
+
+            // until the first duplicate, every element stays in place: a self move assignment may leave the payload in a moved-from state
+            if (result != i)
+            {
+                uuids[result]   = uuids[i];
+                payload[result] = std::move(payload[i]);
+            }
+            ++result;
+        }
+        return result;
+    }
+}
@@ -88,8 +88,9 @@ namespace HORIZON::ALGORITHM::CONCURRENT
 
         /*!
          * @brief Closes the container for modification and notifies all waiting threads.
+         * @note Containers that block on other condition variables than _containerCV override this to wake their waiters.
          */
-        void close()
+        virtual void close()
         {
             //I need to lock access to closing while modifications might take place
             auto token = Guard();
@@ -166,6 +167,14 @@ namespace HORIZON::ALGORITHM::CONCURRENT
         [[nodiscard]] inline bool CanModify() const
         { return !(is_closed()); }
 
+        /*!
+         * @brief Throws if the container is closed.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        inline void ThrowIfClosed() const
+        { if (is_closed()) throw ContainerClosedError(); }
+
 
         /*!
          * @brief Checks if the given token belongs to this class.
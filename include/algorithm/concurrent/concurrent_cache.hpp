@@ -0,0 +1,431 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 16:40
+// @project Horizon
+//
+
+
+#pragma once
+
+#include "algorithm/concurrent/concurrent_base.hpp"
+#include "algorithm/concurrent/sharding.hpp"
+#include <unordered_map>
+#include <vector>
+#include <optional>
+#include <future>
+#include <memory>
+#include <functional>
+#include <algorithm>
+#include <thread>
+#include <cstdint>
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief Hit/miss/eviction counters of a concurrent_cache.
+     */
+    struct cache_statistics
+    {
+        /*!
+         * @brief Lookups that found the key.
+         */
+        std::uint64_t hits = 0;
+        /*!
+         * @brief Lookups that did not find the key (and computed it, for get_or_compute).
+         */
+        std::uint64_t misses = 0;
+        /*!
+         * @brief get_or_compute calls that waited for a computation already running in another thread.
+         */
+        std::uint64_t coalesced = 0;
+        /*!
+         * @brief Elements removed to make room for new ones.
+         */
+        std::uint64_t evictions = 0;
+    };
+
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A bounded concurrent cache with CLOCK eviction.
+     * @copydetails concurrent_base
+     *
+     * @details The cache uses the sharding of concurrent_unorderedmap: keys are distributed over independently locked shards, so hits on
+     * different shards do not contend. Each shard holds capacity / shard_count elements in a ring and evicts with the CLOCK algorithm (a second
+     * chance approximation of LRU): a hit only sets a reference bit, the eviction hand skips (and clears) referenced elements.
+     *
+     * get_or_compute is single-flight: if several threads miss the same key, only the first one computes the value, the others wait for its
+     * result. The computation runs without holding any lock.
+     *
+     * Modifying methods throw a ContainerClosedError if the container is closed.
+     *
+     * @tparam Key      The key type.
+     * @tparam T        The cached value type. Must be copy constructible.
+     * @tparam Hash     The hash function.
+     * @tparam KeyEqual The key comparison.
+     */
+    template<typename Key,
+             typename T,
+             typename Hash = std::hash<Key>,
+             typename KeyEqual = std::equal_to<Key>>
+    class concurrent_cache : public virtual concurrent_base
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+    private:
+        struct Entry
+        {
+            std::optional<std::pair<key_type, mapped_type>> _item;
+            bool                                             _referenced = false;
+        };
+
+        // a running get_or_compute computation
+        struct Flight
+        {
+            std::shared_future<mapped_type> _result;
+            bool                            _stale = false;    // put, erase or clear touched the key, the result must not be cached
+        };
+
+        struct alignas(64) Shard
+        {
+            mutable std::mutex _access;
+
+            std::vector<Entry>                                          _ring;
+            std::unordered_map<key_type, size_type, hasher, key_equal> _index;
+            std::unordered_map<key_type, Flight, hasher, key_equal>    _inFlight;
+            size_type                                                   _hand = 0;
+
+            cache_statistics _statistics;
+        };
+
+        std::unique_ptr<Shard[]> _shards;
+        size_type                _shardMask;
+        size_type                _capacity;
+        hasher                   _hash;
+
+    public:
+        /*!
+         * @brief Creates an empty cache.
+         * @param capacity      The maximum number of elements. Split evenly over the shards (at least one element per shard).
+         * @param shardCount    The number of shards. Rounded up to a power of two.
+         * @param hash          The hash function.
+         * @param equal         The key comparison.
+         */
+        explicit concurrent_cache(size_type capacity,
+                                  size_type shardCount = DefaultShardCount(),
+                                  hasher const& hash = hasher(),
+                                  key_equal const& equal = key_equal()) :
+                _shards(std::make_unique<Shard[]>(SHARDING::RoundUpToPowerOfTwo(shardCount))),
+                _shardMask(SHARDING::RoundUpToPowerOfTwo(shardCount) - 1),
+                _hash(hash)
+        {
+            auto const perShard = std::max<size_type>(1, (capacity + _shardMask) / (_shardMask + 1));
+            _capacity = perShard * (_shardMask + 1);
+
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                auto& shard = _shards[i];
+                shard._ring.resize(perShard);
+                shard._index    = decltype(shard._index)(perShard, hash, equal);
+                shard._inFlight = decltype(shard._inFlight)(0, hash, equal);
+            }
+        }
+
+        concurrent_cache(concurrent_cache const&) = delete;
+        concurrent_cache& operator=(concurrent_cache const&) = delete;
+
+        /*!
+         * @brief Closes the cache and destroys the cache object.
+         */
+        ~concurrent_cache()
+        { close(); }
+
+        /*!
+         * @return The default number of shards: four per hardware thread, rounded up to a power of two.
+         */
+        [[nodiscard]] static size_type DefaultShardCount() noexcept
+        { return SHARDING::DefaultShardCount(); }
+
+        /*!
+         * @return The maximum number of elements.
+         */
+        [[nodiscard]] inline size_type capacity() const noexcept
+        { return _capacity; }
+
+        /*!
+         * @return The number of cached elements. Shards are counted one after another.
+         */
+        [[nodiscard]] size_type size() const
+        {
+            size_type result = 0;
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i]._access);
+                result += _shards[i]._index.size();
+            }
+            return result;
+        }
+
+        using concurrent_base::empty;
+
+        [[nodiscard]] bool empty(access_token const& token) const override
+        {
+            CheckForOwnership(token);
+            return size() == 0;
+        }
+
+        /*!
+         * @return The sum of the counters of all shards.
+         */
+        [[nodiscard]] cache_statistics statistics() const
+        {
+            cache_statistics result;
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i]._access);
+                auto const& statistics = _shards[i]._statistics;
+
+                result.hits += statistics.hits;
+                result.misses += statistics.misses;
+                result.coalesced += statistics.coalesced;
+                result.evictions += statistics.evictions;
+            }
+            return result;
+        }
+
+        /*!
+         * @brief Removes all elements. Running computations still return their value, but do not cache it.
+         */
+        void clear()
+        {
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                auto& shard = _shards[i];
+                std::lock_guard<std::mutex> lock(shard._access);
+
+                for (auto& entry : shard._ring) entry = Entry();
+                for (auto& flight : shard._inFlight) flight.second._stale = true;
+                shard._index.clear();
+                shard._hand = 0;
+            }
+        }
+
+
+        /*!
+         * @brief Copies a cached value.
+         * @param key   The key.
+         * @param item  Receives the value on a hit.
+         * @return True on a hit.
+         */
+        bool get(key_type const& key, mapped_type& item)
+        {
+            auto& shard = ShardOf(key);
+            std::lock_guard<std::mutex> lock(shard._access);
+
+            auto it = shard._index.find(key);
+            if (it == shard._index.end())
+            {
+                ++shard._statistics.misses;
+                return false;
+            }
+
+            auto& entry = shard._ring[it->second];
+            entry._referenced = true;
+            item = entry._item->second;
+
+            ++shard._statistics.hits;
+            return true;
+        }
+
+        /*!
+         * @brief Inserts a value or replaces the cached value of a key. May evict another element.
+         * @details A running get_or_compute of the key does not overwrite this value.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        void put(key_type const& key, mapped_type value)
+        {
+            auto& shard = ShardOf(key);
+            std::lock_guard<std::mutex> lock(shard._access);
+            ThrowIfClosed();
+
+            Invalidate(shard, key);
+            Store(shard, key, std::move(value));
+        }
+
+        /*!
+         * @brief Removes a key. A running get_or_compute of the key does not cache its result.
+         * @return True if the key was cached.
+         */
+        bool erase(key_type const& key)
+        {
+            auto& shard = ShardOf(key);
+            std::lock_guard<std::mutex> lock(shard._access);
+
+            Invalidate(shard, key);
+
+            auto it = shard._index.find(key);
+            if (it == shard._index.end()) return false;
+
+            shard._ring[it->second] = Entry();
+            shard._index.erase(it);
+            return true;
+        }
+
+        /*!
+         * @brief Returns the cached value of a key, computing (and caching) it on a miss.
+         * @details If another thread is already computing the key, this waits for its result instead of computing it again. If the computation
+         * throws, the exception is passed to all waiting threads and nothing is cached. If the key is put, erased or cleared while the value is
+         * computed, the value is returned but not cached, so it does not overwrite the newer state.
+         *
+         * @param key       The key.
+         * @param compute   Called with the key on a miss. Returns the value. Called without holding any lock of the cache.
+         * @return The value.
+         *
+         * @throws ContainerClosedError If the key has to be computed and the container is closed.
+         */
+        template<class Compute>
+        mapped_type get_or_compute(key_type const& key, Compute&& compute)
+        {
+            auto& shard = ShardOf(key);
+
+            std::promise<mapped_type> promise;
+            {
+                std::unique_lock<std::mutex> lock(shard._access);
+
+                auto it = shard._index.find(key);
+                if (it != shard._index.end())
+                {
+                    auto& entry = shard._ring[it->second];
+                    entry._referenced = true;
+
+                    ++shard._statistics.hits;
+                    return entry._item->second;
+                }
+
+                // single flight: wait for the running computation
+                auto flight = shard._inFlight.find(key);
+                if (flight != shard._inFlight.end())
+                {
+                    auto future = flight->second._result;
+                    ++shard._statistics.coalesced;
+
+                    lock.unlock();
+                    return future.get();
+                }
+
+                ThrowIfClosed();
+
+                ++shard._statistics.misses;
+                shard._inFlight.emplace(key, Flight{ promise.get_future().share() });
+            }
+
+            // once the flight is removed, another thread may start a new flight of the key: it must not be removed again
+            bool landed = false;
+            try
+            {
+                mapped_type value = std::invoke(std::forward<Compute>(compute), key);
+
+                {
+                    std::lock_guard<std::mutex> lock(shard._access);
+
+                    auto flight = shard._inFlight.find(key);
+                    bool const stale = flight == shard._inFlight.end() || flight->second._stale;
+                    if (flight != shard._inFlight.end()) shard._inFlight.erase(flight);
+                    landed = true;
+
+                    if (!stale && CanModify()) Store(shard, key, value);
+                }
+
+                promise.set_value(value);
+                return value;
+            }
+            catch (...)
+            {
+                if (!landed)
+                {
+                    std::lock_guard<std::mutex> lock(shard._access);
+                    shard._inFlight.erase(key);
+                }
+
+                promise.set_exception(std::current_exception());
+                throw;
+            }
+        }
+
+    private:
+        inline Shard& ShardOf(key_type const& key) noexcept
+        { return _shards[SHARDING::ShardIndex(static_cast<std::uint64_t>(_hash(key)), _shardMask)]; }
+
+        // marks a running computation of the key as stale. The shard must be locked.
+        static void Invalidate(Shard& shard, key_type const& key)
+        {
+            auto flight = shard._inFlight.find(key);
+            if (flight != shard._inFlight.end()) flight->second._stale = true;
+        }
+
+        // inserts or replaces a value. The shard must be locked. If an exception is thrown, ring and index still agree
+        void Store(Shard& shard, key_type const& key, mapped_type value)
+        {
+            auto it = shard._index.find(key);
+            if (it != shard._index.end())
+            {
+                auto& entry = shard._ring[it->second];
+                entry._item->second = std::move(value);
+                entry._referenced   = true;
+                return;
+            }
+
+            // the copy of the key and the index node are made before anything changes
+            std::pair<key_type, mapped_type> item(key, std::move(value));
+
+            auto const slot = NextVictim(shard);
+            auto const indexed = shard._index.emplace(key, slot).first;
+
+            auto& entry = shard._ring[slot];
+            try
+            {
+                if (entry._item)
+                {
+                    shard._index.erase(entry._item->first);
+                    entry._item.reset();
+                    ++shard._statistics.evictions;
+                }
+
+                entry._item.emplace(std::move(item));
+                entry._referenced = false;
+            }
+            catch (...)
+            {
+                shard._index.erase(indexed);
+                throw;
+            }
+        }
+
+        // CLOCK: advance the hand until a free or unreferenced entry is found, giving referenced entries a second chance
+        static size_type NextVictim(Shard& shard) noexcept
+        {
+            auto const size = shard._ring.size();
+            for (;;)
+            {
+                auto& entry = shard._ring[shard._hand];
+                auto const slot = shard._hand;
+                shard._hand = (shard._hand + 1) % size;
+
+                if (!entry._item || !entry._referenced) return slot;
+                entry._referenced = false;
+            }
+        }
+    };
+}
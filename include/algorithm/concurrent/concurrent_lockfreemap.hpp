@@ -0,0 +1,631 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 22:10
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <thread>
+#include <type_traits>
+#include <algorithm>
+
+#include "algorithm/concurrent/epoch_domain.hpp"
+#include "algorithm/concurrent/sharding.hpp"
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A lock-free, open-addressing hash map for trivially copyable keys and values.
+     *
+     * @details Unlike the other concurrent containers, this map does not use a mutex (and thus does not provide access tokens or close
+     * semantics). Slots are probed linearly. Each slot has an atomic control word (state and version), the key and value are stored in atomic
+     * 64 bit words. Keys are compared bitwise, hence the requirement for unique object representations.
+     *
+     * - Lookups only write the epoch record of the calling thread and never wait for other readers. A lookup of a key that is not being
+     *   modified costs one probe sequence, usually a single cache miss. Values of up to 8 bytes are stored in a single atomic word, so their
+     *   lookups are wait-free: they never wait for a writer either.
+     * - Inserts claim an empty slot with a single CAS. Erased keys leave a tombstone that is reused if the same key is inserted again.
+     * - Once the table is 3/4 full, a new table with room for four times the live elements is allocated. Every subsequent writing operation
+     *   migrates a chunk of slots (cooperative migration) until the old table is fully moved, so no single operation pays for the whole resize.
+     *   Tombstones are dropped, so the capacity follows the number of elements and not the number of inserts.
+     * - Fully migrated tables are retired to an epoch_domain and freed once no operation can probe them anymore.
+     *
+     * @tparam Key  The key type. Must be trivially copyable with unique object representations (no padding), e.g. UUID or integers.
+     * @tparam T    The mapped type. Must be trivially copyable.
+     * @tparam Hash The hash function.
+     *
+     * @note Lookups of values larger than 8 bytes are not wait-free. Such a lookup of a key whose value is being replaced waits until the writer
+     * finished its store (seqlock), so a writer that is descheduled in the middle of that store stalls the lookups of the same key. Writes of
+     * the same key wait for each other for every value size. Operations on other keys are not affected.
+     */
+    template<typename Key,
+             typename T,
+             typename Hash = std::hash<Key>>
+    class concurrent_lockfreemap
+    {
+        static_assert(std::is_trivially_copyable_v<Key>, "The key type must be trivially copyable.");
+        static_assert(std::has_unique_object_representations_v<Key>, "The key type is compared bitwise and must not contain padding.");
+        static_assert(std::is_trivially_copyable_v<T>, "The mapped type must be trivially copyable.");
+
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = std::size_t;
+        using hasher = Hash;
+
+    private:
+        static constexpr const size_type KeyWords   = (sizeof(key_type) + 7) / 8;
+        static constexpr const size_type ValueWords = (sizeof(mapped_type) + 7) / 8;
+
+        static constexpr const size_type MinimumCapacity = 16;
+        static constexpr const size_type MigrationChunk  = 256;
+
+        using key_words = std::array<std::uint64_t, KeyWords>;
+        using value_words = std::array<std::uint64_t, ValueWords>;
+
+        // the lower bits of the control word hold the state, the remaining bits a version that is increased on every value change
+        enum : std::uint64_t
+        {
+            Empty       = 0,    // never used
+            Inserting   = 1,    // claimed (or a tombstone being revived), key and value are being written
+            Full        = 2,    // key and value are valid
+            Writing     = 3,    // the value of a Full slot is being replaced
+            Deleted     = 4,    // tombstone, the key is valid
+            Moving      = 5,    // frozen, being copied to the next table
+            Moved       = 6,    // the slot is dead, the key (if any) continues in the next table
+            Sealed      = 7,    // was empty when the table migrated, still ends every probe sequence
+            StateMask   = 7,
+            VersionStep = 8
+        };
+
+        struct Slot
+        {
+            std::atomic<std::uint64_t> _control{ Empty };
+            std::atomic<std::uint64_t> _key[KeyWords];
+            std::atomic<std::uint64_t> _value[ValueWords];
+        };
+
+        struct Table
+        {
+            size_type const         _capacity;
+            size_type const         _mask;
+            std::unique_ptr<Slot[]> _slots;
+
+            std::atomic<size_type> _used{ 0 };              // claimed slots (including tombstones and migrated entries)
+            std::atomic<Table*>    _next{ nullptr };        // the table this table migrates to
+            std::atomic<size_type> _migrationCursor{ 0 };   // next chunk to migrate
+            std::atomic<size_type> _migrated{ 0 };          // migrated slots
+
+            explicit Table(size_type capacity) :
+                    _capacity(capacity),
+                    _mask(capacity - 1),
+                    _slots(std::make_unique<Slot[]>(capacity))
+            { }
+
+            [[nodiscard]] inline size_type Threshold() const noexcept
+            { return _capacity / 4 * 3; }
+        };
+
+        mutable epoch_domain        _epochs{ 1 };
+        std::atomic<Table*>         _current;
+        std::atomic<std::ptrdiff_t> _size{ 0 };
+        hasher                      _hash;
+
+    public:
+        /*!
+         * @brief Creates an empty map.
+         * @param capacity  The initial number of slots. Rounded up to a power of two.
+         * @param hash      The hash function.
+         */
+        explicit concurrent_lockfreemap(size_type capacity = MinimumCapacity, hasher const& hash = hasher()) :
+                _current(new Table(SHARDING::RoundUpToPowerOfTwo(std::max(capacity, MinimumCapacity)))),
+                _hash(hash)
+        { }
+
+        concurrent_lockfreemap(concurrent_lockfreemap const&) = delete;
+        concurrent_lockfreemap& operator=(concurrent_lockfreemap const&) = delete;
+
+        ~concurrent_lockfreemap()
+        {
+            // older tables were retired and are freed by the epoch domain
+            for (Table* table = _current.load(std::memory_order_relaxed); table != nullptr;)
+            {
+                Table* next = table->_next.load(std::memory_order_relaxed);
+                delete table;
+                table = next;
+            }
+        }
+
+        /*!
+         * @return The number of elements. This is only exact if no other thread modifies the map.
+         */
+        [[nodiscard]] inline size_type size() const noexcept
+        { return static_cast<size_type>(std::max<std::ptrdiff_t>(0, _size.load(std::memory_order_relaxed))); }
+
+        [[nodiscard]] inline bool empty() const noexcept
+        { return size() == 0; }
+
+        /*!
+         * @return The number of slots of the current table.
+         */
+        [[nodiscard]] inline size_type capacity() const noexcept
+        { return _current.load(std::memory_order_acquire)->_capacity; }
+
+
+        /*!
+         * @brief Copies the mapped value of a key.
+         * @param key   The key.
+         * @param item  Receives the mapped value if the key is present.
+         * @return True if the key is present.
+         */
+        bool find(key_type const& key, mapped_type& item) const
+        {
+            auto const words = ToWords(key);
+            auto const hash  = HashOf(key);
+            auto const scope = _epochs.pin();
+
+            for (Table* table = _current.load(std::memory_order_acquire); table != nullptr; table = table->_next.load(std::memory_order_acquire))
+            {
+                size_type index = hash & table->_mask;
+                for (size_type probe = 0; probe < table->_capacity; ++probe, index = (index + 1) & table->_mask)
+                {
+                    Slot const& slot    = table->_slots[index];
+                    std::uint64_t control = slot._control.load(std::memory_order_acquire);
+                    std::uint64_t state   = control & StateMask;
+
+                    // the end of the probe sequence. The key may have been inserted into the next table (if any)
+                    if (state == Empty || state == Sealed) break;
+                    // not yet published, the insert has not happened. Moved slots of other keys are skipped, the slots behind them may not have
+                    // been migrated yet
+                    if (state == Inserting || !KeyEquals(slot, words)) continue;
+
+                    for (;;)
+                    {
+                        // Inserting: erased and being revived while the value was copied
+                        if (state == Deleted || state == Inserting) return false;
+                        if (state == Moved) break;
+
+                        if constexpr (ValueWords == 1)
+                        {
+                            // a single word is replaced atomically: while the slot is Writing, the old and the new value are both valid
+                            // (a revived tombstone is Inserting, not Writing). The lookup never waits
+                            auto const value = slot._value[0].load(std::memory_order_relaxed);
+                            std::memcpy(&item, &value, sizeof(mapped_type));
+                            return true;
+                        }
+
+                        if (state == Writing)
+                        {
+                            Pause();
+                            control = slot._control.load(std::memory_order_acquire);
+                            state   = control & StateMask;
+                            continue;
+                        }
+
+                        // seqlock read: the value is valid if the control word did not change while copying
+                        value_words value;
+                        for (size_type i = 0; i < ValueWords; ++i) value[i] = slot._value[i].load(std::memory_order_relaxed);
+                        std::atomic_thread_fence(std::memory_order_acquire);
+
+                        std::uint64_t const check = slot._control.load(std::memory_order_relaxed);
+                        if (check == control)
+                        {
+                            std::memcpy(&item, value.data(), sizeof(mapped_type));
+                            return true;
+                        }
+
+                        control = check;
+                        state   = control & StateMask;
+                    }
+                    break;
+                }
+            }
+
+            return false;
+        }
+
+        /*!
+         * @param key The key.
+         * @return True if the key is present.
+         */
+        [[nodiscard]] inline bool contains(key_type const& key) const
+        {
+            mapped_type item;
+            return find(key, item);
+        }
+
+        /*!
+         * @brief Inserts a key-value pair if the key is not present.
+         * @return True if the pair was inserted.
+         */
+        inline bool insert(key_type const& key, mapped_type const& value)
+        { return Upsert<false>(key, value); }
+
+        /*!
+         * @brief Inserts a key-value pair or replaces the mapped value of an existing key.
+         * @return True if the pair was inserted, false if the value was replaced.
+         */
+        inline bool insert_or_assign(key_type const& key, mapped_type const& value)
+        { return Upsert<true>(key, value); }
+
+        /*!
+         * @brief Removes a key.
+         * @return True if the key was present.
+         */
+        bool erase(key_type const& key)
+        {
+            auto const words = ToWords(key);
+            auto const hash  = HashOf(key);
+            auto const scope = _epochs.pin();
+
+            for (Table* table = _current.load(std::memory_order_acquire);;)
+            {
+                HelpMigrate(table);
+
+                bool   erased = false;
+                Table* next   = EraseIn(table, words, hash, erased);
+                if (next == nullptr) return erased;
+
+                table = next;
+            }
+        }
+
+    private:
+        static inline void Pause() noexcept
+        { std::this_thread::yield(); }
+
+        static inline std::uint64_t NextVersion(std::uint64_t control) noexcept
+        { return (control & ~std::uint64_t(StateMask)) + VersionStep; }
+
+        static inline std::uint64_t Version(std::uint64_t control) noexcept
+        { return control & ~std::uint64_t(StateMask); }
+
+        inline std::uint64_t HashOf(key_type const& key) const noexcept
+        {
+            // murmur3 finaliser, the slot index uses the low bits
+            auto hash = static_cast<std::uint64_t>(_hash(key));
+            hash ^= hash >> 33;
+            hash *= UINT64_C(0xFF51AFD7ED558CCD);
+            hash ^= hash >> 33;
+            hash *= UINT64_C(0xC4CEB9FE1A85EC53);
+            hash ^= hash >> 33;
+            return hash;
+        }
+
+        template<typename V, size_type N>
+        static inline std::array<std::uint64_t, N> ToWordsImpl(V const& value) noexcept
+        {
+            std::array<std::uint64_t, N> words{ };
+            std::memcpy(words.data(), &value, sizeof(V));
+            return words;
+        }
+
+        static inline key_words ToWords(key_type const& key) noexcept
+        { return ToWordsImpl<key_type, KeyWords>(key); }
+
+        static inline value_words ToValueWords(mapped_type const& value) noexcept
+        { return ToWordsImpl<mapped_type, ValueWords>(value); }
+
+        static inline bool KeyEquals(Slot const& slot, key_words const& words) noexcept
+        {
+            for (size_type i = 0; i < KeyWords; ++i) { if (slot._key[i].load(std::memory_order_relaxed) != words[i]) return false; }
+            return true;
+        }
+
+        static inline void StoreValue(Slot& slot, value_words const& value) noexcept
+        {
+            for (size_type i = 0; i < ValueWords; ++i) slot._value[i].store(value[i], std::memory_order_relaxed);
+        }
+
+        static inline void StoreKey(Slot& slot, key_words const& key) noexcept
+        {
+            for (size_type i = 0; i < KeyWords; ++i) slot._key[i].store(key[i], std::memory_order_relaxed);
+        }
+
+
+        template<bool Assign>
+        bool Upsert(key_type const& key, mapped_type const& value)
+        {
+            auto const keyWords   = ToWords(key);
+            auto const valueWords = ToValueWords(value);
+            auto const hash       = HashOf(key);
+            auto const scope      = _epochs.pin();
+
+            for (Table* table = _current.load(std::memory_order_acquire);;)
+            {
+                HelpMigrate(table);
+
+                bool   inserted = false;
+                Table* next     = UpsertIn<Assign>(table, keyWords, valueWords, hash, inserted);
+                if (next == nullptr) return inserted;
+
+                table = next;
+            }
+        }
+
+        // returns nullptr if the operation completed, otherwise the table to continue with
+        template<bool Assign>
+        Table* UpsertIn(Table* table, key_words const& keyWords, value_words const& valueWords, std::uint64_t hash, bool& inserted)
+        {
+            size_type index = hash & table->_mask;
+            for (size_type probe = 0; probe < table->_capacity; ++probe, index = (index + 1) & table->_mask)
+            {
+                Slot& slot = table->_slots[index];
+                std::uint64_t control = slot._control.load(std::memory_order_acquire);
+
+                for (;;)
+                {
+                    std::uint64_t const state = control & StateMask;
+
+                    if (state == Empty)
+                    {
+                        if (Table* next = table->_next.load(std::memory_order_acquire)) return next;
+                        if (table->_used.load(std::memory_order_relaxed) + 1 > table->Threshold()) return StartMigration(table);
+
+                        if (!slot._control.compare_exchange_weak(control, Inserting, std::memory_order_acq_rel)) continue;
+
+                        table->_used.fetch_add(1, std::memory_order_relaxed);
+                        StoreKey(slot, keyWords);
+                        StoreValue(slot, valueWords);
+                        slot._control.store(Full, std::memory_order_release);
+
+                        _size.fetch_add(1, std::memory_order_relaxed);
+                        inserted = true;
+                        return nullptr;
+                    }
+                    if (state == Inserting || state == Writing)
+                    {
+                        Pause();
+                        control = slot._control.load(std::memory_order_acquire);
+                        continue;
+                    }
+                    if (state == Sealed) return table->_next.load(std::memory_order_acquire);
+                    if (!KeyEquals(slot, keyWords)) break;
+                    if (state == Moved) return table->_next.load(std::memory_order_acquire);
+                    if (state == Moving) return CompleteMove(table, slot, control);
+
+                    if (state == Full && !Assign)
+                    {
+                        inserted = false;
+                        return nullptr;
+                    }
+                    // a migrating table does not revive tombstones, the new table was sized for the live elements only
+                    if (state == Deleted)
+                    {
+                        if (Table* next = table->_next.load(std::memory_order_acquire))
+                        {
+                            MigrateSlot(table, slot);
+                            return next;
+                        }
+                    }
+
+                    // Full (assign): replace the value under the seqlock. Deleted (revive): like an insert, lookups skip the slot until it is
+                    // Full again, so they never read the erased value
+                    auto const claimed = (state == Deleted ? Inserting : Writing) | Version(control);
+                    if (!slot._control.compare_exchange_weak(control, claimed, std::memory_order_acq_rel)) continue;
+
+                    std::atomic_thread_fence(std::memory_order_release);
+                    StoreValue(slot, valueWords);
+                    slot._control.store(Full | NextVersion(control), std::memory_order_release);
+
+                    inserted = state == Deleted;
+                    if (inserted) _size.fetch_add(1, std::memory_order_relaxed);
+                    return nullptr;
+                }
+            }
+
+            // no free slot in this table
+            return StartMigration(table);
+        }
+
+
+        // returns nullptr if the operation completed, otherwise the table to continue with
+        Table* EraseIn(Table* table, key_words const& keyWords, std::uint64_t hash, bool& erased)
+        {
+            size_type index = hash & table->_mask;
+            for (size_type probe = 0; probe < table->_capacity; ++probe, index = (index + 1) & table->_mask)
+            {
+                Slot& slot = table->_slots[index];
+                std::uint64_t control = slot._control.load(std::memory_order_acquire);
+
+                for (;;)
+                {
+                    std::uint64_t const state = control & StateMask;
+
+                    // the end of the probe sequence. The key may have been inserted into the next table (if any)
+                    if (state == Empty || state == Sealed) return table->_next.load(std::memory_order_acquire);
+                    if (state == Inserting || state == Writing)
+                    {
+                        Pause();
+                        control = slot._control.load(std::memory_order_acquire);
+                        continue;
+                    }
+                    if (!KeyEquals(slot, keyWords)) break;
+                    if (state == Moved) return table->_next.load(std::memory_order_acquire);
+                    if (state == Deleted) return nullptr;
+                    if (state == Moving) return CompleteMove(table, slot, control);
+
+                    // Full
+                    if (!slot._control.compare_exchange_weak(control, Deleted | NextVersion(control), std::memory_order_acq_rel)) continue;
+
+                    _size.fetch_sub(1, std::memory_order_relaxed);
+                    erased = true;
+                    return nullptr;
+                }
+            }
+
+            return table->_next.load(std::memory_order_acquire);
+        }
+
+
+        /*
+         * Migration
+         */
+
+        // creates the next table (if not done yet) and returns it
+        Table* StartMigration(Table* table)
+        {
+            Table* next = table->_next.load(std::memory_order_acquire);
+            if (next != nullptr) return next;
+
+            // table is the newest table. Older tables must be fully migrated first, so at most one migration runs at a time.
+            for (Table* current = _current.load(std::memory_order_acquire); current != table; current = _current.load(std::memory_order_acquire))
+            {
+                // table may have been migrated in the meantime. Its successor is published before the current table moves past it, so a
+                // table without successor is newer than the current one.
+                next = table->_next.load(std::memory_order_acquire);
+                if (next != nullptr) return next;
+
+                FinishMigration(current);
+            }
+
+            // only live elements are copied. Inserts stop at 3/4 of the new table, which leaves a quarter (at least the live elements) for the
+            // copies. Tombstones are neither copied nor revived while migrating, so the size does not grow with the number of erased keys.
+            auto const live     = size();
+            auto const capacity = SHARDING::RoundUpToPowerOfTwo(std::max(MinimumCapacity, 4 * live));
+
+            auto* created = new Table(capacity);
+
+            if (table->_next.compare_exchange_strong(next, created, std::memory_order_acq_rel)) return created;
+
+            delete created;
+            return next;
+        }
+
+        // migrates one chunk of table, if it is being migrated
+        void HelpMigrate(Table* table)
+        {
+            Table* next = table->_next.load(std::memory_order_acquire);
+            if (next == nullptr) return;
+
+            auto const start = table->_migrationCursor.fetch_add(MigrationChunk, std::memory_order_relaxed);
+            if (start >= table->_capacity) return;
+
+            auto const end = std::min(start + MigrationChunk, table->_capacity);
+            for (size_type i = start; i < end; ++i) MigrateSlot(table, table->_slots[i]);
+
+            if (table->_migrated.fetch_add(end - start, std::memory_order_acq_rel) + (end - start) == table->_capacity)
+            {
+                // operations that loaded the old table before may still probe it
+                Table* expected = table;
+                if (_current.compare_exchange_strong(expected, next, std::memory_order_acq_rel)) _epochs.retire(table);
+            }
+        }
+
+        // migrates table completely and waits until the current table advanced
+        void FinishMigration(Table* table)
+        {
+            while (table->_migrationCursor.load(std::memory_order_relaxed) < table->_capacity) HelpMigrate(table);
+            while (_current.load(std::memory_order_acquire) == table) Pause();
+        }
+
+        void MigrateSlot(Table* table, Slot& slot)
+        {
+            std::uint64_t control = slot._control.load(std::memory_order_acquire);
+
+            for (;;)
+            {
+                std::uint64_t const state = control & StateMask;
+
+                switch (state)
+                {
+                    case Empty:
+                        if (slot._control.compare_exchange_weak(control, Sealed, std::memory_order_acq_rel)) return;
+                        break;
+
+                    case Deleted:
+                        // nothing to copy. Tombstones are dropped
+                        if (slot._control.compare_exchange_weak(control, Moved, std::memory_order_acq_rel)) return;
+                        break;
+
+                    case Inserting:
+                    case Writing:
+                        Pause();
+                        control = slot._control.load(std::memory_order_acquire);
+                        break;
+
+                    case Full:
+                        if (slot._control.compare_exchange_weak(control, Moving | Version(control), std::memory_order_acq_rel))
+                            control = Moving | Version(control);
+                        break;
+
+                    case Moving:
+                        CompleteMove(table, slot, control);
+                        return;
+
+                    default: // Moved, Sealed
+                        return;
+                }
+            }
+        }
+
+        // copies a frozen slot into the next table, marks it as moved and returns the next table
+        Table* CompleteMove(Table* table, Slot& slot, std::uint64_t control)
+        {
+            Table* next = table->_next.load(std::memory_order_acquire);
+
+            key_words   keyWords;
+            value_words valueWords;
+            for (size_type i = 0; i < KeyWords; ++i) keyWords[i] = slot._key[i].load(std::memory_order_relaxed);
+            for (size_type i = 0; i < ValueWords; ++i) valueWords[i] = slot._value[i].load(std::memory_order_relaxed);
+
+            key_type key;
+            std::memcpy(&key, keyWords.data(), sizeof(key_type));
+            CopyInto(next, keyWords, valueWords, HashOf(key));
+
+            slot._control.compare_exchange_strong(control, Moved, std::memory_order_acq_rel);
+            return next;
+        }
+
+        // inserts the key into table unless the table already has a slot for it (which is then newer)
+        static void CopyInto(Table* table, key_words const& keyWords, value_words const& valueWords, std::uint64_t hash)
+        {
+            size_type index = hash & table->_mask;
+            for (size_type probe = 0; probe < table->_capacity; ++probe, index = (index + 1) & table->_mask)
+            {
+                Slot& slot = table->_slots[index];
+                std::uint64_t control = slot._control.load(std::memory_order_acquire);
+
+                for (;;)
+                {
+                    std::uint64_t const state = control & StateMask;
+
+                    if (state == Empty)
+                    {
+                        if (!slot._control.compare_exchange_weak(control, Inserting, std::memory_order_acq_rel)) continue;
+
+                        table->_used.fetch_add(1, std::memory_order_relaxed);
+                        StoreKey(slot, keyWords);
+                        StoreValue(slot, valueWords);
+                        slot._control.store(Full, std::memory_order_release);
+                        return;
+                    }
+                    if (state == Inserting)
+                    {
+                        Pause();
+                        control = slot._control.load(std::memory_order_acquire);
+                        continue;
+                    }
+                    // the table is already migrating further, which only happens after this copy was completed by another thread
+                    if (state == Moved || state == Sealed) return;
+                    if (KeyEquals(slot, keyWords)) return;
+                    break;
+                }
+            }
+        }
+    };
+}
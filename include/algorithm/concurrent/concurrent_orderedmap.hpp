@@ -0,0 +1,635 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 17:30
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <thread>
+#include <vector>
+#include <algorithm>
+
+#include "algorithm/concurrent/epoch_domain.hpp"
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A concurrent ordered map (skip list) with snapshot consistent range scans.
+     *
+     * @details The map is a lazy skip list: every node has its own mutex, writers only lock the node of their key (updates) or its
+     * predecessors (inserts, removals). Lookups and scans never lock a node.
+     *
+     * Values are versioned. A write publishes a new version first and then stamps it from a global clock. A reader that meets a version that
+     * is not stamped yet stamps it itself (the first stamp wins), so no operation waits for the commit of another writer. A range scan
+     * registers a snapshot (the clock at its start) and reads, for every key, the newest version not newer than its snapshot. A version with
+     * a stamp up to the snapshot was published before the snapshot was taken, so the snapshot is stable. Writers continue while a scan runs,
+     * the scan does not see their changes. Versions that no snapshot can see are pruned on the next write of the key; erased keys are unlinked
+     * once no snapshot can see their old value.
+     *
+     * Like concurrent_lockfreemap, the map does not use a container mutex (and thus does not provide access tokens or close semantics).
+     *
+     * @tparam Key      The key type. Must be copy constructible.
+     * @tparam T        The mapped type. Must be copy constructible.
+     * @tparam Compare  The key ordering.
+     *
+     * @note Lookups, scans and writes run inside a guard of an epoch_domain. Unlinked nodes and pruned versions are retired to it and released
+     * once no operation that could reach them is running. A long scan delays the release of everything retired after it started.
+     */
+    template<typename Key,
+             typename T,
+             typename Compare = std::less<Key>>
+    class concurrent_orderedmap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = std::size_t;
+        using key_compare = Compare;
+
+    private:
+        using stamp_type = std::uint64_t;
+
+        // 4^16 keys before the list degrades
+        static constexpr const int MaxLevel = 16;
+
+        static constexpr const stamp_type NoSnapshot = std::numeric_limits<stamp_type>::max();
+        static constexpr const stamp_type Unstamped  = std::numeric_limits<stamp_type>::max();
+
+        struct Version
+        {
+            std::atomic<stamp_type>    _stamp{ Unstamped };
+            std::atomic<Version*>      _older{ nullptr };
+            std::optional<mapped_type> _value;                  // empty for erased keys
+
+            explicit Version(std::optional<mapped_type> value) :
+                    _value(std::move(value))
+            { }
+
+            // deletes this version and all older versions
+            static void DeleteChain(Version* version) noexcept
+            {
+                while (version != nullptr)
+                {
+                    Version* older = version->_older.load(std::memory_order_relaxed);
+                    delete version;
+                    version = older;
+                }
+            }
+        };
+
+        struct ChainDeleter
+        {
+            void operator()(Version* version) const noexcept
+            { Version::DeleteChain(version); }
+        };
+
+        struct Node;
+
+        // the head of the list has no key, so the links and locks live in a base
+        struct NodeBase
+        {
+            std::mutex                              _access;
+            int const                               _level;
+            std::unique_ptr<std::atomic<Node*>[]>   _next;
+            std::atomic<bool>                       _marked{ false };       // being unlinked
+            std::atomic<bool>                       _fullyLinked{ false };  // linked on all levels
+
+            explicit NodeBase(int level) :
+                    _level(level),
+                    _next(std::make_unique<std::atomic<Node*>[]>(level))
+            {
+                for (int i = 0; i < level; ++i) _next[i].store(nullptr, std::memory_order_relaxed);
+            }
+        };
+
+        struct Node : NodeBase
+        {
+            key_type              _key;
+            std::atomic<Version*> _newest;
+            bool                  _deferred = false;                        // erased, waiting in _deferred for the unlink. Guarded by _access
+
+            Node(key_type const& key, int level, Version* version) :
+                    NodeBase(level),
+                    _key(key),
+                    _newest(version)
+            { }
+
+            ~Node()
+            { Version::DeleteChain(_newest.load(std::memory_order_relaxed)); }
+        };
+
+        enum class WriteMode
+        {
+            Insert,
+            Assign,
+            Erase
+        };
+
+        NodeBase    _head{ MaxLevel };
+        key_compare _compare;
+
+        std::atomic<std::ptrdiff_t> _size{ 0 };
+
+        // version clock, hands out stamps. A snapshot sees the versions with a stamp up to the clock at its start
+        mutable std::atomic<stamp_type> _clock{ 0 };
+
+        // registered snapshots of running scans
+        mutable std::mutex                  _snapshotAccess;
+        mutable std::multiset<stamp_type>   _snapshots;
+        mutable std::atomic<stamp_type>     _oldestSnapshot{ NoSnapshot };
+
+        // erased nodes that a snapshot can still see
+        std::mutex             _deferredAccess;
+        std::vector<Node*>     _deferred;
+        std::atomic<size_type> _deferredCount{ 0 };
+
+        mutable epoch_domain _epochs;
+
+    public:
+        /*!
+         * @brief Creates an empty map.
+         * @param compare The key ordering.
+         */
+        explicit concurrent_orderedmap(key_compare const& compare = key_compare()) :
+                _compare(compare)
+        { }
+
+        concurrent_orderedmap(concurrent_orderedmap const&) = delete;
+        concurrent_orderedmap& operator=(concurrent_orderedmap const&) = delete;
+
+        ~concurrent_orderedmap()
+        {
+            // unlinked nodes and pruned versions are released by the epoch domain
+            for (Node* node = _head._next[0].load(std::memory_order_relaxed); node != nullptr;)
+            {
+                Node* next = node->_next[0].load(std::memory_order_relaxed);
+                delete node;
+                node = next;
+            }
+        }
+
+        /*!
+         * @return The number of elements. Only a momentary value while the map is modified concurrently.
+         */
+        [[nodiscard]] inline size_type size() const noexcept
+        { return static_cast<size_type>(std::max<std::ptrdiff_t>(0, _size.load(std::memory_order_relaxed))); }
+
+        /*!
+         * @return True if the map is empty. Only a momentary value while the map is modified concurrently.
+         */
+        [[nodiscard]] inline bool empty() const noexcept
+        { return size() == 0; }
+
+
+        /*!
+         * @brief Inserts an element if its key is not present.
+         * @param key   The key.
+         * @param value The mapped value.
+         * @return True if the element was inserted.
+         */
+        bool insert(key_type const& key, mapped_type const& value)
+        { return Write<WriteMode::Insert>(key, std::make_unique<Version>(value)); }
+
+        /*!
+         * @brief Inserts a value or assigns it to an existing key.
+         * @param key   The key.
+         * @param value The mapped value.
+         * @return True if the value was inserted, false if it was assigned.
+         */
+        bool insert_or_assign(key_type const& key, mapped_type const& value)
+        { return Write<WriteMode::Assign>(key, std::make_unique<Version>(value)); }
+
+        /*!
+         * @brief Removes a key.
+         * @param key The key.
+         * @return True if the key was present.
+         */
+        bool erase(key_type const& key)
+        { return Write<WriteMode::Erase>(key, std::make_unique<Version>(std::nullopt)); }
+
+        /*!
+         * @brief Copies the mapped value of a key.
+         * @param key   The key.
+         * @param item  Receives the mapped value if the key is present.
+         * @return True if the key is present.
+         */
+        bool find(key_type const& key, mapped_type& item) const
+        {
+            auto const scope = _epochs.pin();
+
+            Node* node = LowerBound(key);
+            if (node == nullptr || _compare(key, node->_key)) return false;
+
+            // stamp the version if its writer did not yet, so later snapshots see it as well
+            Version* version = node->_newest.load(std::memory_order_acquire);
+            StampOf(*version);
+
+            if (!version->_value) return false;
+            item = *version->_value;
+            return true;
+        }
+
+        /*!
+         * @param key The key.
+         * @return True if the key is present.
+         */
+        [[nodiscard]] bool contains(key_type const& key) const
+        {
+            auto const scope = _epochs.pin();
+
+            Node* node = LowerBound(key);
+            if (node == nullptr || _compare(key, node->_key)) return false;
+
+            Version* version = node->_newest.load(std::memory_order_acquire);
+            StampOf(*version);
+
+            return version->_value.has_value();
+        }
+
+        /*!
+         * @brief Calls @p function for every element with a key in [lo, hi), in key order, as of the start of the call.
+         * @details Writers are not blocked. Changes made while the scan runs (including changes by @p function) are not visited.
+         *
+         * @param lo        The first key of the range.
+         * @param hi        The end of the range (exclusive).
+         * @param function  Called with key_type const& and mapped_type const&.
+         * @return The number of visited elements.
+         */
+        template<class Function>
+        size_type range(key_type const& lo, key_type const& hi, Function&& function) const
+        {
+            SnapshotScope snapshot(*this);
+            auto const    scope = _epochs.pin();
+
+            return Scan(LowerBound(lo), &hi, snapshot._stamp, function);
+        }
+
+        /*!
+         * @brief Calls @p function for every element, in key order, as of the start of the call.
+         * @copydetails range
+         *
+         * @param function  Called with key_type const& and mapped_type const&.
+         * @return The number of visited elements.
+         */
+        template<class Function>
+        size_type for_each(Function&& function) const
+        {
+            SnapshotScope snapshot(*this);
+            auto const    scope = _epochs.pin();
+
+            return Scan(_head._next[0].load(std::memory_order_acquire), nullptr, snapshot._stamp, function);
+        }
+
+    private:
+        // registers a snapshot of a scan, so writers keep the versions it can see
+        struct SnapshotScope
+        {
+            concurrent_orderedmap const&                    _map;
+            typename std::multiset<stamp_type>::iterator    _entry;
+            stamp_type                                      _stamp;
+
+            explicit SnapshotScope(concurrent_orderedmap const& map) :
+                    _map(map)
+            {
+                {
+                    std::lock_guard<std::mutex> lock(_map._snapshotAccess);
+                    _entry = _map._snapshots.insert(_map._clock.load());
+                    _map._oldestSnapshot.store(*_map._snapshots.begin());
+                }
+
+                // a writer that read the oldest snapshot before the registration pruned up to a stamp it loaded before, which is not newer
+                _stamp = _map._clock.load();
+            }
+
+            ~SnapshotScope()
+            {
+                std::lock_guard<std::mutex> lock(_map._snapshotAccess);
+                _map._snapshots.erase(_entry);
+                _map._oldestSnapshot.store(_map._snapshots.empty() ? NoSnapshot : *_map._snapshots.begin());
+            }
+        };
+
+        template<WriteMode Mode>
+        bool Write(key_type const& key, std::unique_ptr<Version> version)
+        {
+            auto const scope = _epochs.pin();
+
+            bool const result = WriteIn<Mode>(key, std::move(version));
+            if (_deferredCount.load(std::memory_order_relaxed) != 0 && _oldestSnapshot.load() == NoSnapshot) UnlinkDeferred();
+
+            return result;
+        }
+
+        template<WriteMode Mode>
+        bool WriteIn(key_type const& key, std::unique_ptr<Version> version)
+        {
+            NodeBase* preds[MaxLevel];
+            Node*     succs[MaxLevel];
+
+            // a node allocated by a failed insert attempt, owns the version
+            std::unique_ptr<Node> created;
+
+            for (;;)
+            {
+                int const found = FindNode(key, preds, succs);
+
+                if (found != -1)
+                {
+                    Node* node = succs[found];
+
+                    if (created)
+                    {
+                        version.reset(created->_newest.exchange(nullptr));
+                        created.reset();
+                    }
+
+                    // retry once the node is unlinked
+                    if (node->_marked.load())
+                    {
+                        std::this_thread::yield();
+                        continue;
+                    }
+                    while (!node->_fullyLinked.load()) std::this_thread::yield();
+
+                    std::lock_guard<std::mutex> lock(node->_access);
+                    if (node->_marked.load()) continue;
+
+                    bool const present = node->_newest.load(std::memory_order_relaxed)->_value.has_value();
+                    if (Mode == WriteMode::Insert && present) return false;
+                    if (Mode == WriteMode::Erase && !present) return false;
+
+                    // publish, then stamp. The stamps of a key increase along the chain, the node stays locked until the version is stamped
+                    Version* added = version.release();
+                    added->_older.store(node->_newest.load(std::memory_order_relaxed), std::memory_order_relaxed);
+                    node->_newest.store(added, std::memory_order_release);
+                    StampOf(*added);
+
+                    if (Mode == WriteMode::Erase) _size.fetch_sub(1, std::memory_order_relaxed);
+                    else if (!present) _size.fetch_add(1, std::memory_order_relaxed);
+
+                    Prune(*node);
+                    if (Mode == WriteMode::Erase) UnlinkOrDefer(*node);
+
+                    return Mode == WriteMode::Erase || !present;
+                }
+
+                if (Mode == WriteMode::Erase) return false;
+
+                // allocate before locking, the node only becomes visible when linked
+                if (!created)
+                {
+                    created = std::make_unique<Node>(key, RandomLevel(), version.get());
+                    version.release();
+                }
+
+                int const level = created->_level;
+
+                std::unique_lock<std::mutex> locks[MaxLevel];
+                if (!LockPredecessors(preds, succs, level, locks, [](NodeBase* pred, Node* succ, int i) {
+                    return (succ == nullptr || !succ->_marked.load()) && pred->_next[i].load() == succ;
+                })) continue;
+
+                Node* linked = created.release();
+                Version* added = linked->_newest.load(std::memory_order_relaxed);
+
+                for (int i = 0; i < level; ++i) linked->_next[i].store(succs[i], std::memory_order_relaxed);
+                for (int i = 0; i < level; ++i) preds[i]->_next[i].store(linked, std::memory_order_release);
+
+                linked->_fullyLinked.store(true);
+                StampOf(*added);
+
+                _size.fetch_add(1, std::memory_order_relaxed);
+                return true;
+            }
+        }
+
+        /*!
+         * @brief Returns the stamp of a published version, stamping it first if its writer did not yet.
+         * @details The stamp is taken from the clock after the version was published, so every snapshot that includes the stamp was taken
+         * after the version became reachable. Writer and readers race with a CAS, the first stamp wins.
+         */
+        inline stamp_type StampOf(Version& version) const noexcept
+        {
+            auto stamp = version._stamp.load(std::memory_order_acquire);
+            if (stamp != Unstamped) return stamp;
+
+            auto const next = _clock.fetch_add(1) + 1;
+            return version._stamp.compare_exchange_strong(stamp, next) ? next : stamp;
+        }
+
+        // versions not newer than this stamp are only needed if they are the newest of their key
+        [[nodiscard]] inline stamp_type PruneBound() const noexcept
+        {
+            // the order matters, see SnapshotScope
+            auto const clock = _clock.load();
+            return std::min(clock, _oldestSnapshot.load());
+        }
+
+        // retires the versions that no snapshot can see. The node must be locked
+        void Prune(Node& node)
+        {
+            auto const bound = PruneBound();
+
+            Version* keep = node._newest.load(std::memory_order_relaxed);
+            while (keep != nullptr && StampOf(*keep) > bound) keep = keep->_older.load(std::memory_order_relaxed);
+            if (keep == nullptr) return;
+
+            // scans that started before may still walk the chain
+            Version* older = keep->_older.exchange(nullptr);
+            if (older != nullptr) _epochs.retire(older, ChainDeleter());
+        }
+
+        // unlinks an erased node, or defers it while a snapshot can still see its old value. The node must be locked
+        void UnlinkOrDefer(Node& node)
+        {
+            if (node._deferred) return;
+
+            if (PruneBound() >= StampOf(*node._newest.load(std::memory_order_relaxed)))
+            {
+                Unlink(node);
+                return;
+            }
+
+            std::lock_guard<std::mutex> lock(_deferredAccess);
+            _deferred.push_back(&node);
+            _deferredCount.fetch_add(1);
+            node._deferred = true;
+        }
+
+        // unlinks the deferred nodes that are no longer visible to any snapshot. Deferred nodes are only unlinked here
+        void UnlinkDeferred()
+        {
+            std::vector<Node*> deferred;
+            {
+                std::lock_guard<std::mutex> lock(_deferredAccess);
+                deferred.swap(_deferred);
+            }
+
+            std::vector<Node*> remaining;
+            for (auto* node : deferred)
+            {
+                std::lock_guard<std::mutex> lock(node->_access);
+
+                Version* newest = node->_newest.load(std::memory_order_relaxed);
+                if (newest->_value)
+                {
+                    // inserted again
+                    node->_deferred = false;
+                    continue;
+                }
+
+                if (PruneBound() < StampOf(*newest))
+                {
+                    remaining.push_back(node);
+                    continue;
+                }
+
+                node->_deferred = false;
+                Prune(*node);
+                Unlink(*node);
+            }
+
+            std::lock_guard<std::mutex> lock(_deferredAccess);
+            _deferred.insert(_deferred.end(), remaining.begin(), remaining.end());
+            _deferredCount.store(_deferred.size());
+        }
+
+        // removes a node from all levels and retires it. The node must be locked and fully linked
+        void Unlink(Node& node)
+        {
+            node._marked.store(true);
+
+            NodeBase* preds[MaxLevel];
+            Node*     succs[MaxLevel];
+
+            for (;;)
+            {
+                FindNode(node._key, preds, succs);
+
+                std::unique_lock<std::mutex> locks[MaxLevel];
+                if (!LockPredecessors(preds, succs, node._level, locks, [&node](NodeBase* pred, Node*, int i) {
+                    return pred->_next[i].load() == &node;
+                })) continue;
+
+                for (int i = node._level - 1; i >= 0; --i) preds[i]->_next[i].store(node._next[i].load(std::memory_order_relaxed), std::memory_order_release);
+                break;
+            }
+
+            _epochs.retire(&node);
+        }
+
+        // locks the distinct predecessors of the lowest levels (highest key first, which is the lock order of the list) and validates them
+        template<class Validate>
+        static bool LockPredecessors(NodeBase** preds, Node** succs, int level, std::unique_lock<std::mutex>* locks, Validate&& validate)
+        {
+            NodeBase* lastLocked = nullptr;
+            for (int i = 0; i < level; ++i)
+            {
+                NodeBase* pred = preds[i];
+                if (pred != lastLocked)
+                {
+                    locks[i] = std::unique_lock<std::mutex>(pred->_access);
+                    lastLocked = pred;
+                }
+
+                if (pred->_marked.load() || !validate(pred, succs[i], i)) return false;
+            }
+            return true;
+        }
+
+        /*!
+         * @brief Searches the predecessors and successors of a key on all levels.
+         * @return The highest level the key was found on, or -1.
+         */
+        int FindNode(key_type const& key, NodeBase** preds, Node** succs)
+        {
+            int found = -1;
+            NodeBase* pred = &_head;
+
+            for (int i = MaxLevel - 1; i >= 0; --i)
+            {
+                Node* current = pred->_next[i].load(std::memory_order_acquire);
+                while (current != nullptr && _compare(current->_key, key))
+                {
+                    pred = current;
+                    current = pred->_next[i].load(std::memory_order_acquire);
+                }
+
+                if (found == -1 && current != nullptr && !_compare(key, current->_key)) found = i;
+
+                preds[i] = pred;
+                succs[i] = current;
+            }
+
+            return found;
+        }
+
+        // the first node with a key not less than key
+        Node* LowerBound(key_type const& key) const
+        {
+            NodeBase const* pred = &_head;
+            Node* current = nullptr;
+
+            for (int i = MaxLevel - 1; i >= 0; --i)
+            {
+                current = pred->_next[i].load(std::memory_order_acquire);
+                while (current != nullptr && _compare(current->_key, key))
+                {
+                    pred = current;
+                    current = pred->_next[i].load(std::memory_order_acquire);
+                }
+            }
+
+            return current;
+        }
+
+        template<class Function>
+        size_type Scan(Node* node, key_type const* hi, stamp_type stamp, Function& function) const
+        {
+            size_type count = 0;
+
+            // unlinked nodes still point into the list and are not released while the guard of the scan is alive
+            for (; node != nullptr && (hi == nullptr || _compare(node->_key, *hi)); node = node->_next[0].load(std::memory_order_acquire))
+            {
+                Version* version = node->_newest.load(std::memory_order_acquire);
+                while (version != nullptr && StampOf(*version) > stamp) version = version->_older.load(std::memory_order_acquire);
+
+                if (version == nullptr || !version->_value) continue;
+
+                std::invoke(function, static_cast<key_type const&>(node->_key), static_cast<mapped_type const&>(*version->_value));
+                ++count;
+            }
+
+            return count;
+        }
+
+        static int RandomLevel() noexcept
+        {
+            // xorshift, one level per two zero bits (branching factor 4)
+            thread_local std::uint64_t state = std::hash<std::thread::id>()(std::this_thread::get_id()) | 1u;
+            state ^= state << 13u;
+            state ^= state >> 7u;
+            state ^= state << 17u;
+
+            int level = 1;
+            for (auto bits = state; level < MaxLevel && (bits & 3u) == 0; bits >>= 2u) ++level;
+            return level;
+        }
+    };
+}
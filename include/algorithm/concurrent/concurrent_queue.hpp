@@ -350,7 +350,7 @@ namespace HORIZON::ALGORITHM::CONCURRENT
             this->CheckForOwnership(token);
             // ThrowIfClosed();
 
-            std::queue<T> empty;
+            container_type empty;
             std::swap(_container, empty);
         }
 
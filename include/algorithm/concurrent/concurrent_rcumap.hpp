@@ -0,0 +1,502 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 19:50
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <type_traits>
+#include <utility>
+#include <vector>
+#include <algorithm>
+
+#include "algorithm/concurrent/sharding.hpp"
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A read-mostly concurrent hash map (read-copy-update). Readers never lock and never write shared memory.
+     *
+     * @details The map content is an immutable version, published through an atomic pointer. Readers load the current version and read it
+     * without any lock. Writers are serialised, build a new version and publish it with a single atomic exchange. Readers that still use the
+     * old version continue undisturbed.
+     *
+     * A version consists of SegmentCount immutable segments (std::unordered_map). A new version shares all segments with its predecessor except
+     * the ones the write touches, so a single insert copies about size() / SegmentCount elements, not the whole map. Use modify to apply many
+     * changes with one version.
+     *
+     * Old versions are reclaimed with epochs: a reader pins the current epoch in a reader record (one per concurrently reading thread, reused
+     * between reads, never shared by two readers at the same time), the writer frees a retired version once no record pins an epoch from before
+     * the retirement. Reclamation runs during writes, retired versions wait for the next write (or the destruction of the map).
+     *
+     * Like concurrent_lockfreemap, the map does not use a container mutex (and thus does not provide access tokens or close semantics).
+     *
+     * @tparam Key      The key type. Must be copy constructible.
+     * @tparam T        The mapped type. Must be copy constructible.
+     * @tparam Hash     The hash function.
+     * @tparam KeyEqual The key comparison.
+     */
+    template<typename Key,
+             typename T,
+             typename Hash = std::hash<Key>,
+             typename KeyEqual = std::equal_to<Key>>
+    class concurrent_rcumap
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using size_type = std::size_t;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+
+        /*!
+         * @brief The number of segments of a version.
+         */
+        static constexpr const size_type SegmentCount = 64;
+
+    private:
+        using segment_type = std::unordered_map<Key, T, Hash, KeyEqual>;
+
+        struct Version
+        {
+            std::array<std::shared_ptr<segment_type const>, SegmentCount> _segments;
+            size_type                                                     _size = 0;
+        };
+
+        // pins the epoch a reader started in, 0 if the record is free
+        struct alignas(64) Record
+        {
+            std::atomic<std::uint64_t> _pinned{ 0 };
+            Record*                    _next = nullptr;
+        };
+
+        struct Retired
+        {
+            Version const* _version;
+            std::uint64_t  _epoch;
+        };
+
+        // identifies a map instance for the thread local record hint. Never reused, unlike addresses
+        static inline std::atomic<std::uint64_t> NextId{ 1 };
+
+        std::uint64_t const          _id = NextId.fetch_add(1);
+        std::atomic<Version const*>  _current;
+        std::atomic<std::uint64_t>   _epoch{ 1 };
+        mutable std::atomic<Record*> _records{ nullptr };
+
+        std::mutex           _writerAccess;
+        std::vector<Retired> _retired;
+
+        hasher    _hash;
+        key_equal _equal;
+
+    public:
+        /*!
+         * @brief A consistent read-only view of one version. Only valid inside read.
+         */
+        class snapshot
+        {
+            friend class concurrent_rcumap;
+
+            concurrent_rcumap const& _map;
+            Version const&           _version;
+
+            snapshot(concurrent_rcumap const& map, Version const& version) noexcept :
+                    _map(map),
+                    _version(version)
+            { }
+
+        public:
+            /*!
+             * @param key The key.
+             * @return A pointer to the mapped value of the key, or nullptr if the key is not present.
+             */
+            [[nodiscard]] mapped_type const* find(key_type const& key) const
+            {
+                auto const& segment = *_version._segments[_map.SegmentIndex(key)];
+
+                auto it = segment.find(key);
+                return it != segment.end() ? &it->second : nullptr;
+            }
+
+            /*!
+             * @param key The key.
+             * @return True if the key is present.
+             */
+            [[nodiscard]] inline bool contains(key_type const& key) const
+            { return find(key) != nullptr; }
+
+            /*!
+             * @return The number of elements.
+             */
+            [[nodiscard]] inline size_type size() const noexcept
+            { return _version._size; }
+
+            /*!
+             * @brief Calls @p function with key_type const& and mapped_type const& for every element.
+             */
+            template<class Function>
+            void for_each(Function&& function) const
+            {
+                for (auto const& segment : _version._segments)
+                    for (auto const& item : *segment) std::invoke(function, item.first, item.second);
+            }
+        };
+
+        /*!
+         * @brief Modifies the next version inside modify. Segments are copied on their first change.
+         */
+        class editor
+        {
+            friend class concurrent_rcumap;
+
+            concurrent_rcumap const&                                _map;
+            Version&                                                _next;
+            std::array<std::shared_ptr<segment_type>, SegmentCount> _copies;
+            bool                                                    _changed = false;
+
+            editor(concurrent_rcumap const& map, Version& next) noexcept :
+                    _map(map),
+                    _next(next)
+            { }
+
+            segment_type& Writable(size_type index)
+            {
+                if (!_copies[index])
+                {
+                    _copies[index] = std::make_shared<segment_type>(*_next._segments[index]);
+                    _next._segments[index] = _copies[index];
+                }
+
+                _changed = true;
+                return *_copies[index];
+            }
+
+        public:
+            /*!
+             * @param key The key.
+             * @return A pointer to the mapped value of the key in the new version, or nullptr if the key is not present.
+             */
+            [[nodiscard]] mapped_type const* find(key_type const& key) const
+            {
+                auto const& segment = *_next._segments[_map.SegmentIndex(key)];
+
+                auto it = segment.find(key);
+                return it != segment.end() ? &it->second : nullptr;
+            }
+
+            /*!
+             * @return The number of elements in the new version.
+             */
+            [[nodiscard]] inline size_type size() const noexcept
+            { return _next._size; }
+
+            /*!
+             * @brief Inserts an element if its key is not present.
+             * @return True if the element was inserted.
+             */
+            bool insert(key_type const& key, mapped_type const& value)
+            {
+                if (find(key) != nullptr) return false;
+
+                Writable(_map.SegmentIndex(key)).emplace(key, value);
+                ++_next._size;
+                return true;
+            }
+
+            /*!
+             * @brief Inserts a value or assigns it to an existing key.
+             * @return True if the value was inserted, false if it was assigned.
+             */
+            bool insert_or_assign(key_type const& key, mapped_type const& value)
+            {
+                bool const inserted = Writable(_map.SegmentIndex(key)).insert_or_assign(key, value).second;
+                if (inserted) ++_next._size;
+                return inserted;
+            }
+
+            /*!
+             * @brief Removes a key.
+             * @return True if the key was present.
+             */
+            bool erase(key_type const& key)
+            {
+                if (find(key) == nullptr) return false;
+
+                Writable(_map.SegmentIndex(key)).erase(key);
+                --_next._size;
+                return true;
+            }
+
+            /*!
+             * @brief Removes all elements.
+             */
+            void clear()
+            {
+                auto const empty = std::make_shared<segment_type const>(0, _map._hash, _map._equal);
+                for (size_type i = 0; i < SegmentCount; ++i)
+                {
+                    _next._segments[i] = empty;
+                    _copies[i].reset();
+                }
+
+                _next._size = 0;
+                _changed = true;
+            }
+        };
+
+        /*!
+         * @brief Creates an empty map.
+         * @param hash  The hash function.
+         * @param equal The key comparison.
+         */
+        explicit concurrent_rcumap(hasher const& hash = hasher(), key_equal const& equal = key_equal()) :
+                _current(nullptr),
+                _hash(hash),
+                _equal(equal)
+        {
+            // all segments of the empty map share one (empty) segment
+            auto version = std::make_unique<Version>();
+            version->_segments.fill(std::make_shared<segment_type const>(0, _hash, _equal));
+
+            _current.store(version.release());
+        }
+
+        concurrent_rcumap(concurrent_rcumap const&) = delete;
+        concurrent_rcumap& operator=(concurrent_rcumap const&) = delete;
+
+        /*!
+         * @brief Destroys the map. No reader may be active.
+         */
+        ~concurrent_rcumap()
+        {
+            delete _current.load();
+            for (auto const& retired : _retired) delete retired._version;
+
+            for (Record* record = _records.load(); record != nullptr;)
+            {
+                Record* next = record->_next;
+                delete record;
+                record = next;
+            }
+        }
+
+
+        /*!
+         * @return The number of elements of the current version.
+         */
+        [[nodiscard]] size_type size() const
+        { return read([](snapshot const& view) { return view.size(); }); }
+
+        /*!
+         * @return True if the current version is empty.
+         */
+        [[nodiscard]] inline bool empty() const
+        { return size() == 0; }
+
+        /*!
+         * @brief Copies the mapped value of a key.
+         * @param key   The key.
+         * @param item  Receives the mapped value if the key is present.
+         * @return True if the key is present.
+         */
+        bool find(key_type const& key, mapped_type& item) const
+        {
+            return read([&key, &item](snapshot const& view)
+                        {
+                            auto const* value = view.find(key);
+                            if (value == nullptr) return false;
+
+                            item = *value;
+                            return true;
+                        });
+        }
+
+        /*!
+         * @param key The key.
+         * @return True if the key is present.
+         */
+        [[nodiscard]] bool contains(key_type const& key) const
+        { return read([&key](snapshot const& view) { return view.contains(key); }); }
+
+        /*!
+         * @brief Calls @p function with a consistent view of the current version.
+         * @details The view (and references obtained from it) must not escape @p function. Writers are not blocked, but versions retired while
+         * @p function runs are only reclaimed after it returns.
+         *
+         * @param function Called with snapshot const&.
+         * @return The result of @p function.
+         */
+        template<class Function>
+        decltype(auto) read(Function&& function) const
+        {
+            ReadScope scope(*this);
+            return std::invoke(std::forward<Function>(function), snapshot(*this, *_current.load()));
+        }
+
+        /*!
+         * @brief Calls @p function with key_type const& and mapped_type const& for every element of the current version.
+         */
+        template<class Function>
+        void for_each(Function&& function) const
+        { read([&function](snapshot const& view) { view.for_each(function); }); }
+
+
+        /*!
+         * @brief Inserts an element if its key is not present.
+         * @return True if the element was inserted.
+         */
+        bool insert(key_type const& key, mapped_type const& value)
+        { return modify([&](editor& edit) { return edit.insert(key, value); }); }
+
+        /*!
+         * @brief Inserts a value or assigns it to an existing key.
+         * @return True if the value was inserted, false if it was assigned.
+         */
+        bool insert_or_assign(key_type const& key, mapped_type const& value)
+        { return modify([&](editor& edit) { return edit.insert_or_assign(key, value); }); }
+
+        /*!
+         * @brief Removes a key.
+         * @return True if the key was present.
+         */
+        bool erase(key_type const& key)
+        { return modify([&](editor& edit) { return edit.erase(key); }); }
+
+        /*!
+         * @brief Removes all elements.
+         */
+        void clear()
+        { modify([](editor& edit) { edit.clear(); }); }
+
+        /*!
+         * @brief Applies several changes as a single new version.
+         * @details Writers are serialised. Readers see either none or all of the changes. If @p function throws, nothing is published.
+         *
+         * @param function Called with editor&.
+         * @return The result of @p function.
+         */
+        template<class Function>
+        decltype(auto) modify(Function&& function)
+        {
+            std::lock_guard<std::mutex> lock(_writerAccess);
+
+            auto next = std::make_unique<Version>(*_current.load());
+            editor edit(*this, *next);
+
+            if constexpr (std::is_void_v<std::invoke_result_t<Function, editor&>>)
+            {
+                std::invoke(std::forward<Function>(function), edit);
+                if (edit._changed) Publish(std::move(next));
+            }
+            else
+            {
+                decltype(auto) result = std::invoke(std::forward<Function>(function), edit);
+                if (edit._changed) Publish(std::move(next));
+                return result;
+            }
+        }
+
+    private:
+        // pins the epoch for the duration of a read
+        struct ReadScope
+        {
+            Record* _record;
+
+            explicit ReadScope(concurrent_rcumap const& map) :
+                    _record(map.Pin())
+            { }
+
+            ~ReadScope()
+            { _record->_pinned.store(0, std::memory_order_release); }
+        };
+
+        inline size_type SegmentIndex(key_type const& key) const
+        {
+            // fibonacci hashing: the top bits select the segment, the low bits remain for the buckets inside the segment
+            return static_cast<size_type>(SHARDING::FibonacciMix(static_cast<std::uint64_t>(_hash(key))) >> 58u) & (SegmentCount - 1);
+        }
+
+        /*!
+         * @brief Claims a free reader record and pins the current epoch.
+         * @details The record used by the last read of this thread is tried first, it is usually free and in the cache of this thread.
+         * Claiming is a sequentially consistent exchange, so the pin is visible to writers before the version is loaded.
+         */
+        Record* Pin() const
+        {
+            struct Hint
+            {
+                std::uint64_t _map    = 0;
+                Record*       _record = nullptr;
+            };
+            thread_local Hint hint;
+
+            auto const epoch = _epoch.load();
+
+            std::uint64_t expected = 0;
+            if (hint._map == _id && hint._record->_pinned.compare_exchange_strong(expected, epoch)) return hint._record;
+
+            for (Record* record = _records.load(); record != nullptr; record = record->_next)
+            {
+                expected = 0;
+                if (record->_pinned.compare_exchange_strong(expected, epoch))
+                {
+                    hint = { _id, record };
+                    return record;
+                }
+            }
+
+            // more concurrent readers than records: add one
+            auto* record = new Record();
+            record->_pinned.store(epoch, std::memory_order_relaxed);
+            record->_next = _records.load();
+            while (!_records.compare_exchange_weak(record->_next, record)) { }
+
+            hint = { _id, record };
+            return record;
+        }
+
+        // publishes a version and retires the previous one. The writer mutex must be locked
+        void Publish(std::unique_ptr<Version> next)
+        {
+            _retired.reserve(_retired.size() + 1);
+
+            Version const* previous = _current.exchange(next.release());
+            _retired.push_back({ previous, _epoch.fetch_add(1) });
+
+            Reclaim();
+        }
+
+        // frees the retired versions that no reader can use anymore. The writer mutex must be locked
+        void Reclaim()
+        {
+            auto oldest = std::numeric_limits<std::uint64_t>::max();
+            for (Record* record = _records.load(); record != nullptr; record = record->_next)
+            {
+                auto const pinned = record->_pinned.load();
+                if (pinned != 0) oldest = std::min(oldest, pinned);
+            }
+
+            // readers that pinned a later epoch loaded the version after it was replaced
+            auto const end = std::partition(_retired.begin(), _retired.end(), [oldest](Retired const& retired) { return retired._epoch >= oldest; });
+            for (auto it = end; it != _retired.end(); ++it) delete it->_version;
+            _retired.erase(end, _retired.end());
+        }
+    };
+}
@@ -0,0 +1,355 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 19:05
+// @project Horizon
+//
+
+
+#pragma once
+
+#include "concurrent_base.hpp"
+#include <vector>
+#include <tuple>
+#include <utility>
+#include <stdexcept>
+#include <type_traits>
+
+#if __has_include(<span>)
+#include <span>
+#endif
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A contiguous, non-owning view of one column of a concurrent_soavector.
+     * @details The view is only valid as long as the access token it was obtained with is held and the container is not resized.
+     * @tparam T The column element type (const qualified for read-only views).
+     */
+    template<typename T>
+    class column_view
+    {
+    public:
+        using value_type = std::remove_const_t<T>;
+        using size_type = std::size_t;
+        using pointer = T*;
+        using reference = T&;
+        using iterator = T*;
+
+    private:
+        pointer   _data = nullptr;
+        size_type _size = 0;
+
+    public:
+        constexpr column_view() noexcept = default;
+
+        constexpr column_view(pointer data, size_type size) noexcept :
+                _data(data),
+                _size(size)
+        { }
+
+        [[nodiscard]] constexpr pointer data() const noexcept
+        { return _data; }
+
+        [[nodiscard]] constexpr size_type size() const noexcept
+        { return _size; }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        { return _size == 0; }
+
+        constexpr iterator begin() const noexcept
+        { return _data; }
+
+        constexpr iterator end() const noexcept
+        { return _data + _size; }
+
+        constexpr reference operator[](size_type index) const noexcept
+        { return _data[index]; }
+
+#if defined(__cpp_lib_span)
+        constexpr operator std::span<T>() const noexcept
+        { return std::span<T>(_data, _size); }
+#endif
+    };
+
+
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A concurrent struct-of-arrays vector.
+     * @copydetails concurrent_base
+     *
+     * @details Each field of a record is stored in its own contiguous array (column). Scans over a single field only touch the memory of that
+     * field, and the columns can be handed to vectorised loops as plain arrays:
+     * @code{.cpp}
+     * concurrent_soavector<std::uint64_t, float, std::uint32_t> records;
+     * records.push_back(id, price, flags);
+     *
+     * {
+     *      auto token  = records.Guard();
+     *      auto prices = records.column<1>(token);
+     *      float sum   = std::accumulate(prices.begin(), prices.end(), 0.f);
+     * }
+     * @endcode
+     * All columns always have the same size. Modifying methods throw a ContainerClosedError if the container is closed.
+     *
+     * @tparam Ts The column types, in record order.
+     *
+     * @note Like concurrent_vector, this gets extended upon need.
+     */
+    template<typename... Ts>
+    class concurrent_soavector : public virtual concurrent_base
+    {
+        static_assert(sizeof...(Ts) > 0, "A concurrent_soavector requires at least one column.");
+        static_assert(!(std::is_same_v<Ts, bool> || ...), "bool columns are not contiguous (std::vector<bool>). Use std::uint8_t instead.");
+
+    public:
+        using value_type = std::tuple<Ts...>;
+        using container_type = std::tuple<std::vector<Ts>...>;
+        using size_type = std::size_t;
+        using access_type = size_type;
+
+        /*!
+         * @brief The type of the column at index I.
+         */
+        template<std::size_t I>
+        using column_type = std::tuple_element_t<I, value_type>;
+
+        /*!
+         * @brief The number of columns.
+         */
+        static constexpr const std::size_t column_count = sizeof...(Ts);
+
+    private:
+        container_type _columns;
+
+        using index_sequence = std::index_sequence_for<Ts...>;
+
+    public:
+        /*!
+         * @return Gets the number of records in the container.
+         */
+        [[nodiscard]] inline size_type size() const
+        { return size(Guard()); }
+
+        /*!
+         * @brief Gets the number of records if the container is owned by the calling thread.
+         * @param token The access token.
+         * @return The number of records.
+         */
+        [[nodiscard]] inline size_type size(access_token const& token) const
+        {
+            CheckForOwnership(token);
+            return std::get<0>(_columns).size();
+        }
+
+        using concurrent_base::empty;
+
+        [[nodiscard]] inline bool empty(access_token const& token) const override
+        {
+            CheckForOwnership(token);
+            return std::get<0>(_columns).empty();
+        }
+
+        /*!
+         * @brief Reserves space for records in all columns.
+         * @param size The new capacity (in records).
+         */
+        void reserve(size_type size)
+        { reserve(size, Guard()); }
+
+        /*!
+         * @copydoc reserve(size_type)
+         * @param token The access token.
+         */
+        void reserve(size_type size, access_token const& token)
+        {
+            CheckForOwnership(token);
+            std::apply([size](auto& ... column) { (column.reserve(size), ...); }, _columns);
+        }
+
+        /*!
+         * @brief Resizes all columns. New records are value-initialised.
+         * @param size The new size (in records).
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        void resize(size_type size)
+        { resize(size, Guard()); }
+
+        /*!
+         * @copydoc resize(size_type)
+         * @param token The access token.
+         */
+        void resize(size_type size, access_token const& token)
+        {
+            CheckForOwnership(token);
+            ThrowIfClosed();
+
+            std::apply([size](auto& ... column) { (column.resize(size), ...); }, _columns);
+        }
+
+        /*!
+         * @brief Appends a record.
+         * @param fields The fields of the record, in column order.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<typename... Us, typename = std::enable_if_t<sizeof...(Us) == sizeof...(Ts) &&
+                                                            !std::is_same_v<std::decay_t<std::tuple_element_t<0, std::tuple<Us..., void>>>,
+                                                                            access_token>>>
+        void push_back(Us&& ... fields)
+        { push_back(Guard(), std::forward<Us>(fields)...); }
+
+        /*!
+         * @copydoc push_back(Us&& ...)
+         * @param token The access token.
+         */
+        template<typename... Us, typename = std::enable_if_t<sizeof...(Us) == sizeof...(Ts)>>
+        void push_back(access_token const& token, Us&& ... fields)
+        {
+            CheckForOwnership(token);
+            ThrowIfClosed();
+
+            PushBackHelper(index_sequence(), std::forward_as_tuple(std::forward<Us>(fields)...));
+        }
+
+        /*!
+         * @brief Appends a record given as tuple.
+         * @param record The record.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        void push_back_record(value_type const& record)
+        { push_back_record(record, Guard()); }
+
+        /*!
+         * @copydoc push_back_record(value_type const&)
+         * @param token The access token.
+         */
+        void push_back_record(value_type const& record, access_token const& token)
+        {
+            CheckForOwnership(token);
+            ThrowIfClosed();
+
+            PushBackHelper(index_sequence(), record);
+        }
+
+        /*!
+         * @brief Copies a whole record out of the container.
+         * @param index The record index.
+         * @return A copy of the record.
+         *
+         * @throws out_of_range If @p index is out of bounds.
+         */
+        [[nodiscard]] value_type record(access_type index) const
+        { return record(index, Guard()); }
+
+        /*!
+         * @copydoc record(access_type) const
+         * @param token The access token.
+         */
+        [[nodiscard]] value_type record(access_type index, access_token const& token) const
+        {
+            if (index >= size(token)) throw std::out_of_range("Parameter \"index\" is out of bounds.");
+
+            return std::apply([index](auto const& ... column) { return value_type(column[index]...); }, _columns);
+        }
+
+        /*!
+         * @brief Removes a record by moving the last record into its place. This does not preserve the order of records.
+         * @param index The record index.
+         *
+         * @throws out_of_range If @p index is out of bounds.
+         * @throws ContainerClosedError If the container is closed.
+         */
+        void SwapRemove(access_type index)
+        { SwapRemove(index, Guard()); }
+
+        /*!
+         * @copydoc SwapRemove(access_type)
+         * @param token The access token.
+         */
+        void SwapRemove(access_type index, access_token const& token)
+        {
+            if (index >= size(token)) throw std::out_of_range("Parameter \"index\" is out of bounds.");
+            ThrowIfClosed();
+
+            // removing the last element only pops it: a self move assignment may leave the element in a moved-from state
+            bool const last = index == size(token) - 1;
+            std::apply([index, last](auto& ... column)
+                       {
+                           ((last ? void() : void(column[index] = std::move(column.back())), column.pop_back()), ...);
+                       }, _columns);
+        }
+
+        /*!
+         * @brief Gets a contiguous view of a single column.
+         * @details Like the iterators of concurrent_vector, the view is only valid while the token is held.
+         * @tparam I The column index.
+         * @param token The access token.
+         * @return A mutable view of the column.
+         *
+         * @warning This is inherently unsafe! Do not use the view after releasing the token.
+         */
+        template<std::size_t I>
+        [[nodiscard]] column_view<column_type<I>> column(access_token const& token) noexcept
+        {
+            CheckForOwnership(token);
+            auto& column = std::get<I>(_columns);
+            return { column.data(), column.size() };
+        }
+
+        /*!
+         * @copydoc column(access_token const&)
+         */
+        template<std::size_t I>
+        [[nodiscard]] column_view<column_type<I> const> column(access_token const& token) const noexcept
+        {
+            CheckForOwnership(token);
+            auto const& column = std::get<I>(_columns);
+            return { column.data(), column.size() };
+        }
+
+        /*!
+         * @brief Clears all columns.
+         */
+        void clear()
+        { clear(Guard()); }
+
+        /*!
+         * @copydoc clear()
+         * @param token The access token.
+         */
+        void clear(access_token const& token)
+        {
+            CheckForOwnership(token);
+            std::apply([](auto& ... column) { (column.clear(), ...); }, _columns);
+        }
+
+    private:
+        template<std::size_t... Is, typename Record>
+        void PushBackHelper(std::index_sequence<Is...>, Record&& record)
+        {
+            // grow all columns up front, so only the element constructors may throw. Columns that were already extended are rolled back.
+            size_type const count = std::get<0>(_columns).size();
+            if (count == std::get<0>(_columns).capacity())
+                (std::get<Is>(_columns).reserve(count == 0 ? 1 : 2 * count), ...);
+
+            try
+            {
+                (std::get<Is>(_columns).push_back(std::get<Is>(std::forward<Record>(record))), ...);
+            }
+            catch (...)
+            {
+                ((std::get<Is>(_columns).size() > count ? std::get<Is>(_columns).pop_back() : void()), ...);
+                throw;
+            }
+        }
+    };
+}
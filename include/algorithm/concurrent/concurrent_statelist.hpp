@@ -11,70 +11,569 @@
 
 #pragma once
 
-#pragma error "Unsupported file included (concurrent_statelist)"
-// #include <vector>
-// #include <mutex>
-// #include <condition_variable>
-//
-// namespace HORIZON::ALGORITHM::CONCURRENT
-// {
-//     template<typename T,
-//              typename S,
-//              typename Allocator = std::allocator<T>>
-//     class concurrent_statelist
-//     {
-//     private:
-//         struct ElementNode;
-//         struct StateNode;
-//
-//
-//         struct ElementNode
-//         {
-//         private:
-//             T _item;
-//             ElementNode* _next;
-//             ElementNode* _previous;
-//             StateNode  * _parent;
-//
-//         public:
-//
-//         };
-//
-//         struct StateNode
-//         {
-//         public:
-//             using const_reference = const S&;
-//
-//         private:
-//             ElementNode* _start;
-//             ElementNode* _end;
-//
-//             const S _state;
-//
-//         public:
-//             explicit StateNode(S const& state) :
-//                     _state(s),
-//                     _start(nullptr),
-//                     _end(nullptr)
-//             { }
-//
-//             inline const_reference State() const
-//             { return _state; }
-//
-//
-//         };
-//
-//
-//     private:
-//         std::vector<ElementNode, Allocator> _container;
-//         // using vector, because usually there are not many states (assuming 2 or 3), so memory alignment is way better
-//         // for finding than a hash table (unordered_map)
-//         std::vector<StateNode>              _states;
-//
-//
-//
-//
-//     public:
-//         void
-//     };
-// }
\ No newline at end of file
+#include "algorithm/concurrent/concurrent_base.hpp"
+#include <vector>
+#include <memory>
+#include <optional>
+#include <limits>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A concurrent container that partitions its elements by a small set of states (e.g. pending, running, done).
+     * @copydetails concurrent_base
+     *
+     * @details Elements are stored contiguously. Each state keeps an intrusive doubly linked list (by index) through the elements in this state,
+     * in the order they entered the state. Moving an element to another state therefore is O(1) and never moves the element itself. Element ids
+     * stay valid until the element is removed, ids of removed elements are reused.
+     *
+     * States are searched linearly: there are usually only a few, so a vector beats a hash table.
+     * Every state has its own condition variable, so pop_from and transition_from only wake threads waiting for the state that received an
+     * element.
+     *
+     * Like concurrent_queue, elements can still be taken from a closed container. All other modifying methods throw a ContainerClosedError if
+     * the container is closed.
+     *
+     * @tparam T            The element type.
+     * @tparam S            The state type. Must be equality comparable.
+     * @tparam Allocator    The allocator of the element storage.
+     */
+    template<typename T,
+             typename S,
+             typename Allocator = std::allocator<T>>
+    class concurrent_statelist : public virtual concurrent_base
+    {
+    public:
+        using value_type = T;
+        using state_type = S;
+        using size_type = std::size_t;
+        using allocator_type = Allocator;
+
+        /*!
+         * @brief Identifies an element. Valid until the element is removed.
+         */
+        using element_id = size_type;
+
+    private:
+        static constexpr const size_type None = std::numeric_limits<size_type>::max();
+
+        struct ElementNode
+        {
+            std::optional<T> _item;
+            size_type        _previous = None;
+            size_type        _next     = None;      // the next free node for free nodes
+            size_type        _state    = None;      // the state index, None for free nodes
+        };
+
+        struct StateNode
+        {
+            size_type               _first = None;
+            size_type               _last  = None;
+            size_type               _count = 0;
+            std::condition_variable _signal;
+        };
+
+        using node_allocator = typename std::allocator_traits<Allocator>::template rebind_alloc<ElementNode>;
+
+        std::vector<ElementNode, node_allocator> _container;
+        size_type                                _free = None;
+        size_type                                _size = 0;
+
+        // using vector, because usually there are not many states (assuming 2 or 3), so memory alignment is way better
+        // for finding than a hash table (unordered_map)
+        std::vector<S>               _stateValues;
+        std::unique_ptr<StateNode[]> _states;
+
+    public:
+        /*!
+         * @brief Creates an empty container.
+         * @param states    The states. Must not contain duplicates.
+         * @param allocator The allocator of the element storage.
+         *
+         * @throws invalid_argument If @p states is empty or contains duplicates.
+         */
+        concurrent_statelist(std::initializer_list<S> states, allocator_type const& allocator = allocator_type()) :
+                concurrent_statelist(std::vector<S>(states), allocator)
+        { }
+
+        /*!
+         * @copydoc concurrent_statelist(std::initializer_list<S>, allocator_type const&)
+         */
+        explicit concurrent_statelist(std::vector<S> states, allocator_type const& allocator = allocator_type()) :
+                _container(node_allocator(allocator)),
+                _stateValues(std::move(states)),
+                _states(std::make_unique<StateNode[]>(_stateValues.size()))
+        {
+            if (_stateValues.empty()) throw std::invalid_argument("concurrent_statelist requires at least one state");
+
+            for (auto it = _stateValues.begin(); it != _stateValues.end(); ++it)
+                if (std::find(std::next(it), _stateValues.end(), *it) != _stateValues.end())
+                    throw std::invalid_argument("concurrent_statelist states must be unique");
+        }
+
+        concurrent_statelist(concurrent_statelist const&) = delete;
+        concurrent_statelist& operator=(concurrent_statelist const&) = delete;
+
+        /*!
+         * @brief Closes the container and destroys the concurrent statelist object.
+         */
+        ~concurrent_statelist()
+        { close(); }
+
+        /*!
+         * @copydoc concurrent_base::close()
+         * @details Also wakes all threads blocked in pop_from or transition_from.
+         */
+        void close() override
+        {
+            concurrent_base::close();
+            for (size_type i = 0; i < _stateValues.size(); ++i) _states[i]._signal.notify_all();
+        }
+
+        /*!
+         * @return The states of this container.
+         */
+        [[nodiscard]] inline std::vector<S> const& states() const noexcept
+        { return _stateValues; }
+
+        using concurrent_base::empty;
+
+        [[nodiscard]] inline bool empty(access_token const& token) const override
+        {
+            CheckForOwnership(token);
+            return _size == 0;
+        }
+
+        /*!
+         * @return The number of elements in all states.
+         */
+        [[nodiscard]] inline size_type size() const
+        { return size(Guard()); }
+
+        /*!
+         * @copydoc size()
+         * @param token The access token of this container.
+         */
+        [[nodiscard]] inline size_type size(access_token const& token) const
+        {
+            CheckForOwnership(token);
+            return _size;
+        }
+
+        /*!
+         * @param state The state.
+         * @return The number of elements in @p state.
+         *
+         * @throws out_of_range If @p state is not a state of this container.
+         */
+        [[nodiscard]] inline size_type count(S const& state) const
+        { return count(state, Guard()); }
+
+        /*!
+         * @copydoc count(S const&) const
+         * @param token The access token of this container.
+         */
+        [[nodiscard]] inline size_type count(S const& state, access_token const& token) const
+        {
+            CheckForOwnership(token);
+            return _states[StateIndex(state)]._count;
+        }
+
+        /*!
+         * @brief Reserves storage for at least @p count elements.
+         */
+        void reserve(size_type count)
+        {
+            auto token = Guard();
+            _container.reserve(count);
+        }
+
+        /*!
+         * @brief Removes all elements.
+         */
+        void clear()
+        { clear(Guard()); }
+
+        /*!
+         * @copydoc clear()
+         * @param token The access token of this container.
+         */
+        void clear(access_token const& token)
+        {
+            CheckForOwnership(token);
+
+            _container.clear();
+            _free = None;
+            _size = 0;
+            for (size_type i = 0; i < _stateValues.size(); ++i)
+            {
+                _states[i]._first = _states[i]._last = None;
+                _states[i]._count = 0;
+            }
+        }
+
+
+        /*!
+         * @brief Adds an element at the end of a state.
+         * @param item  The element.
+         * @param state The state of the element.
+         * @return The id of the element.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         * @throws out_of_range If @p state is not a state of this container.
+         */
+        element_id push(T const& item, S const& state)
+        { return emplace(Guard(), state, item); }
+
+        /*!
+         * @copydoc push(T const&, S const&)
+         * @param token The access token of this container.
+         */
+        element_id push(T const& item, S const& state, access_token const& token)
+        { return emplace(token, state, item); }
+
+        /*!
+         * @copydoc push(T const&, S const&)
+         */
+        element_id push(T&& item, S const& state)
+        { return emplace(Guard(), state, std::move(item)); }
+
+        /*!
+         * @copydoc push(T const&, S const&, access_token const&)
+         */
+        element_id push(T&& item, S const& state, access_token const& token)
+        { return emplace(token, state, std::move(item)); }
+
+        /*!
+         * @brief Constructs an element in place at the end of a state.
+         * @param state The state of the element.
+         * @param args  The arguments to construct the element.
+         * @return The id of the element.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         * @throws out_of_range If @p state is not a state of this container.
+         */
+        template<class... Args>
+        element_id emplace(S const& state, Args&& ... args)
+        { return emplace(Guard(), state, std::forward<Args>(args)...); }
+
+        /*!
+         * @copydoc emplace(S const&, Args&& ...)
+         * @param token The access token of this container.
+         */
+        template<class... Args>
+        element_id emplace(access_token const& token, S const& state, Args&& ... args)
+        {
+            CheckForOwnership(token);
+            ThrowIfClosed();
+
+            auto const stateIndex = StateIndex(state);
+            auto const element    = Allocate(std::forward<Args>(args)...);
+
+            Link(element, stateIndex);
+            ++_size;
+
+            _states[stateIndex]._signal.notify_one();
+            return element;
+        }
+
+        /*!
+         * @brief Moves an element to the end of another state. O(1), the element itself is not moved.
+         * @param element   The element id.
+         * @param newState  The new state of the element.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         * @throws out_of_range If @p newState is not a state of this container or @p element is not a valid id.
+         */
+        void transition(element_id element, S const& newState)
+        { transition(element, newState, Guard()); }
+
+        /*!
+         * @copydoc transition(element_id, S const&)
+         * @param token The access token of this container.
+         */
+        void transition(element_id element, S const& newState, access_token const& token)
+        {
+            CheckForOwnership(token);
+            ThrowIfClosed();
+            CheckElement(element);
+
+            auto const stateIndex = StateIndex(newState);
+
+            Unlink(element);
+            Link(element, stateIndex);
+
+            _states[stateIndex]._signal.notify_one();
+        }
+
+        /*!
+         * @brief Moves the first element of a state to another state.
+         * @details The calling thread is blocked until @p state has an element or until a user specified timeout is reached.
+         * If the timeout is reached or the container is closed, no element is moved and this method returns false.
+         *
+         * @param state             The state to take the element from.
+         * @param newState          The new state of the element.
+         * @param element           Receives the id of the moved element.
+         * @param maximumWaitTime   The maximum time to wait until the operation is aborted.
+         * @return                  True if an element was moved.
+         *
+         * @throws out_of_range If @p state or @p newState is not a state of this container.
+         */
+        bool transition_from(S const& state, S const& newState, element_id& element, time_type const& maximumWaitTime = _maxWaitTime)
+        {
+            auto token = Guard();
+            return transition_from(state, newState, element, token, maximumWaitTime);
+        }
+
+        /*!
+         * @copydoc transition_from(S const&, S const&, element_id&, time_type const&)
+         * @param token The access token of this container. Released while waiting.
+         */
+        bool transition_from(S const& state, S const& newState, element_id& element, access_token& token,
+                             time_type const& maximumWaitTime = _maxWaitTime)
+        {
+            CheckForOwnership(token);
+
+            auto const stateIndex    = StateIndex(state);
+            auto const newStateIndex = StateIndex(newState);
+
+            if (!WaitForElementsIn(stateIndex, token, maximumWaitTime) || !CanModify()) return false;
+
+            element = _states[stateIndex]._first;
+            Unlink(element);
+            Link(element, newStateIndex);
+
+            _states[newStateIndex]._signal.notify_one();
+            return true;
+        }
+
+        /*!
+         * @brief Removes the first element of a state.
+         * @details The calling thread is blocked until @p state has an element or until a user specified timeout is reached.
+         * If the timeout is reached, no element is removed and this method returns false. Elements can still be removed from a closed container.
+         *
+         * @param state             The state to remove the element from.
+         * @param item              The removed element.
+         * @param maximumWaitTime   The maximum time to wait until the pop operation is aborted.
+         * @return                  True if an element was removed.
+         *
+         * @throws out_of_range If @p state is not a state of this container.
+         */
+        bool pop_from(S const& state, T& item, time_type const& maximumWaitTime = _maxWaitTime)
+        {
+            auto token = Guard();
+            return pop_from(state, item, token, maximumWaitTime);
+        }
+
+        /*!
+         * @copydoc pop_from(S const&, T&, time_type const&)
+         * @param token The access token of this container. Released while waiting.
+         */
+        bool pop_from(S const& state, T& item, access_token& token, time_type const& maximumWaitTime = _maxWaitTime)
+        {
+            CheckForOwnership(token);
+
+            auto const stateIndex = StateIndex(state);
+            if (!WaitForElementsIn(stateIndex, token, maximumWaitTime)) return false;
+
+            auto const element = _states[stateIndex]._first;
+            item = std::move(*_container[element]._item);
+            Release(element);
+
+            return true;
+        }
+
+        /*!
+         * @brief Removes an element.
+         * @param element The element id.
+         *
+         * @throws out_of_range If @p element is not a valid id.
+         */
+        void erase(element_id element)
+        { erase(element, Guard()); }
+
+        /*!
+         * @copydoc erase(element_id)
+         * @param token The access token of this container.
+         */
+        void erase(element_id element, access_token const& token)
+        {
+            CheckForOwnership(token);
+            CheckElement(element);
+
+            Release(element);
+        }
+
+        /*!
+         * @param element   The element id.
+         * @param token     The access token of this container.
+         * @return A reference to the element.
+         *
+         * @throws out_of_range If @p element is not a valid id.
+         * @warning The reference must not be used after the token is released.
+         */
+        T& at(element_id element, access_token const& token)
+        {
+            CheckForOwnership(token);
+            CheckElement(element);
+            return *_container[element]._item;
+        }
+
+        /*!
+         * @copydoc at(element_id, access_token const&)
+         */
+        T const& at(element_id element, access_token const& token) const
+        {
+            CheckForOwnership(token);
+            CheckElement(element);
+            return *_container[element]._item;
+        }
+
+        /*!
+         * @param element The element id.
+         * @return The state of an element.
+         *
+         * @throws out_of_range If @p element is not a valid id.
+         */
+        [[nodiscard]] S state_of(element_id element) const
+        { return state_of(element, Guard()); }
+
+        /*!
+         * @copydoc state_of(element_id) const
+         * @param token The access token of this container.
+         */
+        [[nodiscard]] S const& state_of(element_id element, access_token const& token) const
+        {
+            CheckForOwnership(token);
+            CheckElement(element);
+            return _stateValues[_container[element]._state];
+        }
+
+        /*!
+         * @brief Calls @p function for every element in a state, in the order the elements entered the state.
+         * @param state     The state.
+         * @param function  Called with element_id and T&. Must not call methods of this container.
+         *
+         * @throws out_of_range If @p state is not a state of this container.
+         */
+        template<class Function>
+        void for_each(S const& state, Function&& function)
+        { for_each(state, std::forward<Function>(function), Guard()); }
+
+        /*!
+         * @copydoc for_each(S const&, Function&&)
+         * @param token The access token of this container.
+         */
+        template<class Function>
+        void for_each(S const& state, Function&& function, access_token const& token)
+        {
+            CheckForOwnership(token);
+
+            for (auto element = _states[StateIndex(state)]._first; element != None; element = _container[element]._next)
+                std::invoke(function, element, *_container[element]._item);
+        }
+
+    private:
+        size_type StateIndex(S const& state) const
+        {
+            auto it = std::find(_stateValues.begin(), _stateValues.end(), state);
+            if (it == _stateValues.end()) throw std::out_of_range("Unknown state of concurrent_statelist");
+
+            return static_cast<size_type>(it - _stateValues.begin());
+        }
+
+        inline void CheckElement(element_id element) const
+        {
+            if (element >= _container.size() || _container[element]._state == None)
+                throw std::out_of_range("Invalid element of concurrent_statelist");
+        }
+
+        // takes a node from the free list or appends one. Nothing changes if the constructor of the element throws
+        template<class... Args>
+        size_type Allocate(Args&& ... args)
+        {
+            if (_free == None)
+            {
+                // the element is constructed before the storage grows: args may refer to an element that the growth would move
+                ElementNode node;
+                node._item.emplace(std::forward<Args>(args)...);
+
+                _container.push_back(std::move(node));
+                return _container.size() - 1;
+            }
+
+            auto const element = _free;
+            _container[element]._item.emplace(std::forward<Args>(args)...);
+            _free = _container[element]._next;
+            return element;
+        }
+
+        // unlinks a node, destroys its element and puts it on the free list
+        void Release(size_type element)
+        {
+            Unlink(element);
+
+            auto& node = _container[element];
+            node._item.reset();
+            node._state = None;
+            node._next  = _free;
+            _free = element;
+            --_size;
+        }
+
+        // appends a node to the list of a state
+        void Link(size_type element, size_type stateIndex) noexcept
+        {
+            auto& node  = _container[element];
+            auto& state = _states[stateIndex];
+
+            node._state    = stateIndex;
+            node._previous = state._last;
+            node._next     = None;
+
+            if (state._last == None) state._first = element;
+            else _container[state._last]._next = element;
+
+            state._last = element;
+            ++state._count;
+        }
+
+        // removes a node from the list of its state
+        void Unlink(size_type element) noexcept
+        {
+            auto& node  = _container[element];
+            auto& state = _states[node._state];
+
+            if (node._previous == None) state._first = node._next;
+            else _container[node._previous]._next = node._next;
+
+            if (node._next == None) state._last = node._previous;
+            else _container[node._next]._previous = node._previous;
+
+            --state._count;
+        }
+
+        /*!
+         * Waits until a state has elements.
+         * Blocks the current thread execution until the state has an element, the container is closed or the wait timeout is reached.
+         * Returns true if the state has an element.
+         */
+        inline bool WaitForElementsIn(size_type stateIndex, access_token& token, time_type const& waitTime)
+        {
+            auto& state = _states[stateIndex];
+
+            // like concurrent_queue: the elements of a closed container can still be taken
+            if (state._count != 0) return true;
+            if (is_closed()) return false;
+
+            state._signal.wait_for(token, waitTime, [this, &state] { return state._count != 0 || is_closed(); });
+            return state._count != 0;
+        }
+    };
+}
@@ -11,12 +11,47 @@
 
 #pragma once
 
-#if 0
 #include "algorithm/concurrent/concurrent_base.hpp"
+#include "algorithm/concurrent/sharding.hpp"
 #include <unordered_map>
+#include <algorithm>
+#include <memory>
+#include <functional>
+#include <condition_variable>
+#include <optional>
+#include <vector>
+#include <iterator>
+#include <stdexcept>
+#include <thread>
+#include <cstdint>
+#include <tuple>
+#include <type_traits>
 
 namespace HORIZON::ALGORITHM::CONCURRENT
 {
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A concurrent hash map, split into independently locked shards.
+     * @copydetails concurrent_base
+     *
+     * @details Keys are distributed over a (power of two) number of shards. Each shard is a std::unordered_map with its own mutex, so operations on
+     * keys in different shards run in parallel. Element access tokens are therefore per shard: use Guard(key_type const&) to obtain the token for
+     * the shard of a key. A shard token is valid for all keys that map to this shard (use ShardIndex to check), passing a token of another
+     * shard is caught by an assertion in debug builds.
+     *
+     * The container token returned by Guard() only serialises container wide operations (clear, close). Container wide reads (size, empty,
+     * for_each) lock one shard at a time and are therefore not a snapshot while other threads modify the map. Never call a container wide method
+     * while holding a shard token, this dead-locks.
+     *
+     * Modifying methods throw a ContainerClosedError if the container is closed.
+     *
+     * @tparam Key          The key type.
+     * @tparam T            The mapped type.
+     * @tparam Hash         The hash function. Used for both the shard selection and the shard buckets.
+     * @tparam KeyEqual     The key comparison.
+     * @tparam Allocator    The allocator of the shard maps.
+     */
     template<typename Key,
              typename T,
              typename Hash = std::hash<Key>,
@@ -30,370 +65,979 @@ namespace HORIZON::ALGORITHM::CONCURRENT
         using mapped_type = typename container_type::mapped_type;
         using value_type = typename container_type::value_type;
         using size_type = typename container_type::size_type;
-        using node_type = typename container_type::node_type;
+        using hasher = Hash;
+        using key_equal = KeyEqual;
+        using allocator_type = Allocator;
 
-        using time_type = std::chrono::nanoseconds;
     private:
-        container_type                   _container;
-        constexpr static const time_type _maxWaitTime = time_type::max();
+        // threads waiting for one key. Removed from the shard when the last waiter leaves
+        struct WaitSlot
+        {
+            std::condition_variable _signal;
+            size_type               _waiters = 0;
+        };
 
+        // each shard lives on its own cache lines, so locking one shard does not invalidate the neighbouring mutex
+        struct alignas(64) Shard
+        {
+            mutable std::mutex _access;
+            container_type     _container;
+            container_type     _draining;       // the previous table while an incremental rehash runs, empty otherwise
 
-    public:
-        // iterators
-        // class iterator
-        // {
-        // public:
-        //     using self_type = iterator;
-        //
-        // private:
-        //     using iterator_type = typename container_type::iterator;
-        //     using reference_type = typename iterator_type::reference;
-        //     using pointer_type = typename iterator_type::pointer;
-        //
-        // private:
-        //     iterator_type& _containerIterator;
-        //     access_token & _token;
-        //
-        // public:
-        //     iterator(iterator_type& iterator, access_token& token) :
-        //             _containerIterator(iterator),
-        //             _token(token)
-        //     { }
-        //
-        //     [[nodiscard]] access_token const& Token() const noexcept
-        //     { return _token; }
-        //
-        //     self_type operator++() noexcept
-        //     {
-        //         _containerIterator.operator++();
-        //         return *this;
-        //     }
-        //
-        //     reference_type operator*() const noexcept
-        //     { return _containerIterator.operator*(); }
-        //
-        //     pointer_type operator->() const noexcept
-        //     { return _containerIterator.operator->(); }
-        // };
-        //
-        //
-        // using iterator_type = iterator;
+            std::unordered_map<Key, WaitSlot, Hash, KeyEqual> _waitSlots;
+        };
+
+        std::unique_ptr<Shard[]> _shards;
+        size_type                _shardMask;
+        hasher                   _hash;
+        std::atomic_bool         _incrementalRehash = false;
+
+        // elements moved from the draining table per operation. Each insert moves more than one element, so a drain finishes before the new
+        // table (twice the size of the old one) is full
+        static constexpr const size_type MigrationStep = 16;
+        // below this shard size, a regular rehash is cheap enough
+        static constexpr const size_type IncrementalRehashMinimum = 1024;
 
     public:
-        // TODO: constructors
+        /*!
+         * @return The default number of shards: four per hardware thread, rounded up to a power of two.
+         */
+        [[nodiscard]] static size_type DefaultShardCount() noexcept
+        { return SHARDING::DefaultShardCount(); }
 
+        /*!
+         * @brief Creates an empty map.
+         * @param shardCount    The number of shards. Rounded up to a power of two.
+         * @param hash          The hash function.
+         * @param equal         The key comparison.
+         * @param allocator     The allocator of the shard maps.
+         */
+        explicit concurrent_unorderedmap(size_type shardCount = DefaultShardCount(),
+                                         hasher const& hash = hasher(),
+                                         key_equal const& equal = key_equal(),
+                                         allocator_type const& allocator = allocator_type()) :
+                _shards(std::make_unique<Shard[]>(SHARDING::RoundUpToPowerOfTwo(shardCount))),
+                _shardMask(SHARDING::RoundUpToPowerOfTwo(shardCount) - 1),
+                _hash(hash)
+        {
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                _shards[i]._container = container_type(0, hash, equal, allocator);
+                _shards[i]._draining  = container_type(0, hash, equal, allocator);
+                _shards[i]._waitSlots = decltype(_shards[i]._waitSlots)(0, hash, equal);
+            }
+        }
+
+        concurrent_unorderedmap(concurrent_unorderedmap const&) = delete;
+        concurrent_unorderedmap& operator=(concurrent_unorderedmap const&) = delete;
+
+        /*!
+         * @brief Closes the map and destroys the concurrent map object.
+         */
         ~concurrent_unorderedmap()
         { close(); }
 
-        inline size_type size() const
-        { return size(std::move(Guard())); }
-
-        inline size_type size(access_token const& token) const
+        /*!
+         * @copydoc concurrent_base::close()
+         * @details Also wakes all threads blocked in wait_for_key.
+         */
+        void close() override
         {
-            CheckForOwnership(token);
-            return _container.size();
+            concurrent_base::close();
+
+            // the close token is set before the shard locks are taken: a waiter either sees the token or is already waiting
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i]._access);
+                for (auto& slot : _shards[i]._waitSlots) slot.second._signal.notify_all();
+            }
         }
 
-        using concurrent_base::empty;
+        using concurrent_base::Guard;
+
+        /*!
+         * @brief Locks the shard of a key and returns its access token.
+         * @param key The key.
+         * @return The access token of the shard.
+         */
+        [[nodiscard]] inline access_token Guard(key_type const& key) const
+        { return access_token(ShardOf(key)._access); }
+
+        /*!
+         * @return The number of shards.
+         */
+        [[nodiscard]] inline size_type shard_count() const noexcept
+        { return _shardMask + 1; }
+
+        /*!
+         * @param key The key.
+         * @return The index of the shard the key belongs to. Keys with the same shard index can share a shard token.
+         */
+        [[nodiscard]] inline size_type ShardIndex(key_type const& key) const
+        { return SHARDING::ShardIndex(static_cast<std::uint64_t>(_hash(key)), _shardMask); }
+
+        /*!
+         * @return True if shards grow by incremental rehashing.
+         */
+        [[nodiscard]] inline bool incremental_rehash() const noexcept
+        { return _incrementalRehash; }
+
+        /*!
+         * @brief Enables or disables incremental rehashing.
+         * @details std::unordered_map rehashes all elements at once when it grows, which stalls every thread waiting for the shard. With
+         * incremental rehashing, a growing shard keeps its old table and allocates a new one of twice the size. Every following operation on
+         * the shard moves a few elements (node extraction, no copies) to the new table, and lookups search both tables until the old one is
+         * empty. No single operation pays for the whole rehash. The operation that starts a rehash still allocates the bucket array of the new
+         * table (without touching any element), which is proportional to the shard size: use enough shards for large maps.
+         *
+         * @param enable True to enable incremental rehashing. A running incremental rehash completes in either case.
+         */
+        inline void incremental_rehash(bool enable) noexcept
+        { _incrementalRehash = enable; }
+
 
-        inline bool empty(access_token const& token) const override
+        /*!
+         * @return The number of elements in the map.
+         * @note Shards are counted one after another. This is not a snapshot while the map is modified concurrently.
+         */
+        [[nodiscard]] size_type size() const
         {
-            CheckForOwnership(token);
-            return _container.empty();
+            size_type result = 0;
+            ForEachShard([&result](Shard const& shard) { result += shard._container.size() + shard._draining.size(); });
+            return result;
         }
 
-        inline size_type max_size() const
-        { return max_size(std::move(Guard())); }
+        using concurrent_base::empty;
 
-        inline size_type max_size(access_token const& token) const
+        /*!
+         * @copydoc concurrent_base::empty(access_token const&) const
+         * @note The token is the container token returned by Guard().
+         */
+        [[nodiscard]] bool empty(access_token const& token) const override
         {
             CheckForOwnership(token);
-            return _container.max_size();
+
+            bool result = true;
+            ForEachShard([&result](Shard const& shard) { result = result && shard._container.empty() && shard._draining.empty(); });
+            return result;
         }
 
+        /*!
+         * @brief Removes all elements.
+         */
         void clear()
-        { clear(std::move(Guard())); }
+        { clear(Guard()); }
 
+        /*!
+         * @copydoc clear()
+         * @param token The container token returned by Guard().
+         */
         void clear(access_token const& token)
         {
             CheckForOwnership(token);
-            _container.clear();
+            ForEachShard([](Shard& shard)
+                         {
+                             shard._container.clear();
+                             shard._draining.clear();
+                         });
         }
 
-        void insert(value_type const& value)
-        { insert(value, std::move(Guard())); }
-
-        void insert(value_type const& value, access_token const& token)
+        /*!
+         * @brief Reserves space for at least @p count elements, spread evenly over the shards.
+         */
+        void reserve(size_type count)
         {
-            CheckForOwnership(token);
+            auto const perShard = (count + _shardMask) / (_shardMask + 1);
+            ForEachShard([perShard](Shard& shard)
+                         {
+                             Migrate(shard, shard._draining.size());
+                             shard._container.reserve(perShard);
+                         });
+        }
+
+
+        /*!
+         * @brief Inserts an element if its key is not present.
+         * @param value The element.
+         * @return True if the element was inserted.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        bool insert(value_type const& value)
+        { return insert(value, Guard(value.first)); }
 
+        /*!
+         * @copydoc insert(value_type const&)
+         * @param token The access token of the key's shard.
+         */
+        bool insert(value_type const& value, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(value.first, token);
             ThrowIfClosed();
 
-            _container.insert(value);
-            _containerCV.notify_one();
+            auto [it, inserted] = shard._container.insert(value);
+            return NotifyIfInserted(shard, it->first, inserted);
         }
 
-        void insert(value_type&& value)
-        { insert(std::forward<value_type>(value), std::move(Guard())); }
-
-        void insert(value_type&& value, access_token const& token)
+        /*!
+         * @copydoc insert(value_type const&)
+         */
+        bool insert(value_type&& value)
         {
-            CheckForOwnership(token);
+            auto token = Guard(value.first);
+            return insert(std::move(value), token);
+        }
 
+        /*!
+         * @copydoc insert(value_type const&, access_token const&)
+         */
+        bool insert(value_type&& value, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(value.first, token);
             ThrowIfClosed();
 
-            _container.insert(std::move(value));
-            _containerCV.notify_one();
+            auto [it, inserted] = shard._container.insert(std::move(value));
+            return NotifyIfInserted(shard, it->first, inserted);
         }
 
-        template<class P>
-        void insert(P&& value)
-        { insert(std::forward<P>(value), std::move(Guard())); }
+        /*!
+         * @brief Inserts a value or assigns it to an existing key.
+         * @param key   The key.
+         * @param value The mapped value.
+         * @return True if the value was inserted, false if it was assigned.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<class M>
+        bool insert_or_assign(key_type const& key, M&& value)
+        { return insert_or_assign(key, std::forward<M>(value), Guard(key)); }
 
-        template<class P>
-        void insert(P&& value, access_token const& token)
+        /*!
+         * @copydoc insert_or_assign(key_type const&, M&&)
+         * @param token The access token of the key's shard.
+         */
+        template<class M>
+        bool insert_or_assign(key_type const& key, M&& value, access_token const& token)
         {
-            CheckForOwnership(token);
-
+            auto& shard = PreparedShardOf(key, token);
             ThrowIfClosed();
 
-            _container.insert(std::forward<P>(value));
-            _containerCV.notify_one();
+            auto [it, inserted] = shard._container.insert_or_assign(key, std::forward<M>(value));
+            return NotifyIfInserted(shard, it->first, inserted);
         }
 
-        template<class InputIt>
-        void insert(InputIt first, InputIt last)
-        { insert(first, last, std::move(Guard())); }
+        /*!
+         * @brief Constructs the mapped value in place if the key is not present.
+         * @param key   The key.
+         * @param args  The arguments to construct the mapped value.
+         * @return True if the value was inserted.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<class... Args>
+        bool emplace(key_type const& key, Args&& ... args)
+        { return emplace(Guard(key), key, std::forward<Args>(args)...); }
 
-        template<class InputIt>
-        void insert(InputIt first, InputIt last, access_token const& token)
+        /*!
+         * @copydoc emplace(key_type const&, Args&& ...)
+         * @param token The access token of the key's shard.
+         */
+        template<class... Args>
+        bool emplace(access_token const& token, key_type const& key, Args&& ... args)
         {
-            CheckForOwnership(token);
+            auto& shard = PreparedShardOf(key, token);
+            ThrowIfClosed();
+
+            auto [it, inserted] = shard._container.try_emplace(key, std::forward<Args>(args)...);
+            return NotifyIfInserted(shard, it->first, inserted);
+        }
+
+        /*!
+         * @brief Removes a key.
+         * @param key The key.
+         * @return The number of removed elements (0 or 1).
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        size_type erase(key_type const& key)
+        { return erase(key, Guard(key)); }
 
+        /*!
+         * @copydoc erase(key_type const&)
+         * @param token The access token of the key's shard.
+         */
+        size_type erase(key_type const& key, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(key, token);
             ThrowIfClosed();
-            _container.insert(first, last);
 
-            _containerCV.notify_all();
+            return shard._container.erase(key);
         }
 
 
-        void insert(std::initializer_list<value_type> ilist)
-        { insert(ilist, std::move(Guard())); }
+        /*!
+         * @brief Returns a reference to the mapped value of a key.
+         * @param key   The key.
+         * @param token The access token of the key's shard.
+         * @return The mapped value.
+         *
+         * @throws out_of_range If the key is not present.
+         * @warning The reference must not be used after the token is released.
+         */
+        mapped_type& at(key_type const& key, access_token const& token)
+        { return PreparedShardOf(key, token)._container.at(key); }
 
-        void insert(std::initializer_list<value_type> ilist, access_token const& token)
+        /*!
+         * @copydoc at(key_type const&, access_token const&)
+         */
+        mapped_type const& at(key_type const& key, access_token const& token) const
         {
-            CheckForOwnership(token);
+            auto const* element = FindElement(OwnedShardOf(key, token), key);
+            if (element == nullptr) throw std::out_of_range("concurrent_unorderedmap::at");
 
-            ThrowIfClosed();
+            return element->second;
+        }
 
-            _container.insert(ilist);
-            _containerCV.notify_all();
+        /*!
+         * @brief Replacement for the bracket operator.
+         * @details Returns a reference to the mapped value of a key, inserting a default constructed value if the key is not present.
+         * @param key   The key.
+         * @param token The access token of the key's shard.
+         * @return The mapped value.
+         *
+         * @throws ContainerClosedError If the key is not present and the container is closed.
+         * @warning The reference must not be used after the token is released.
+         */
+        mapped_type& operator()(key_type const& key, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(key, token);
+
+            auto it = shard._container.find(key);
+            if (it != shard._container.end()) return it->second;
+
+            ThrowIfClosed();
+            it = shard._container.try_emplace(key).first;
+            NotifyIfInserted(shard, key, true);
+            return it->second;
         }
 
-        void insert(node_type&& nh)
-        { insert(std::forward(nh), std::move(nh)); }
+        /*!
+         * @param key The key.
+         * @return The number of elements with the key (0 or 1).
+         */
+        [[nodiscard]] size_type count(key_type const& key) const
+        { return count(key, Guard(key)); }
+
+        /*!
+         * @copydoc count(key_type const&) const
+         * @param token The access token of the key's shard.
+         */
+        [[nodiscard]] size_type count(key_type const& key, access_token const& token) const
+        { return FindElement(OwnedShardOf(key, token), key) != nullptr ? 1 : 0; }
 
-        void insert(node_type&& nh, access_token const& token)
+        /*!
+         * @param key The key.
+         * @return True if the key is present.
+         */
+        [[nodiscard]] inline bool contains(key_type const& key) const
+        { return count(key) != 0; }
+
+        /*!
+         * @brief Copies the mapped value of a key.
+         * @param key   The key.
+         * @param item  Receives the mapped value if the key is present.
+         * @return True if the key is present.
+         */
+        bool find(key_type const& key, mapped_type& item) const
+        { return find(key, item, Guard(key)); }
+
+        /*!
+         * @copydoc find(key_type const&, mapped_type&) const
+         * @param token The access token of the key's shard.
+         */
+        bool find(key_type const& key, mapped_type& item, access_token const& token) const
         {
-            CheckForOwnership(token);
+            auto const* element = FindElement(OwnedShardOf(key, token), key);
+            if (element == nullptr) return false;
+
+            item = element->second;
+            return true;
+        }
+
+        /*!
+         * @brief Removes a key and moves its mapped value out.
+         * @param key   The key.
+         * @param item  Receives the mapped value if the key was present.
+         * @return True if the key was present.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        bool pop_key(key_type const& key, mapped_type& item)
+        { return pop_key(key, item, Guard(key)); }
 
+        /*!
+         * @copydoc pop_key(key_type const&, mapped_type&)
+         * @param token The access token of the key's shard.
+         */
+        bool pop_key(key_type const& key, mapped_type& item, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(key, token);
             ThrowIfClosed();
 
-            _container.insert(std::forward(nh));
-            _containerCV.notify_all();
+            // a single lookup: erase by iterator
+            auto it = shard._container.find(key);
+            if (it == shard._container.end()) return false;
+
+            item = std::move(it->second);
+            shard._container.erase(it);
+            return true;
         }
 
-        template<class M>
-        bool insert_or_assign(key_type const& k, M&& value)
-        { return _container.insert_or_assign(k, std::forward(value), std::move(Guard())).second; }
+        /*!
+         * @brief Atomically computes the mapped value of a key from its current value.
+         * @details @p function is called with a std::optional<mapped_type>& that holds the current mapped value if the key is present. If the
+         * optional holds a value after the call, it is stored for the key, otherwise the key is removed. If @p function throws, a missing key
+         * is not inserted and a present key keeps the value left in the optional (it is removed if the optional is empty).
+         *
+         * @param key       The key.
+         * @param function  The update function. Must not call methods of this map.
+         * @return True if the key is present after the call.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<class Function>
+        bool compute(key_type const& key, Function&& function)
+        { return compute(key, std::forward<Function>(function), Guard(key)); }
 
-        template<class M>
-        bool insert_or_assign(key_type const& k, M&& value, access_token const& token)
+        /*!
+         * @copydoc compute(key_type const&, Function&&)
+         * @param token The access token of the key's shard.
+         */
+        template<class Function>
+        bool compute(key_type const& key, Function&& function, access_token const& token)
         {
-            CheckForOwnership(token);
-
+            auto& shard = PreparedShardOf(key, token);
             ThrowIfClosed();
 
-            return _container.insert_or_assign(k, std::forward(value)).second;
+            auto& container = shard._container;
+            std::optional<mapped_type> value;
+
+            typename container_type::iterator it;
+            bool inserted = false;
+
+            if constexpr (std::is_default_constructible_v<mapped_type>)
+            {
+                // a single lookup: a missing key gets a placeholder, which is erased again if the function does not produce a value
+                std::tie(it, inserted) = container.try_emplace(key);
+            }
+            else
+            {
+                it = container.find(key);
+                if (it == container.end())
+                {
+                    std::invoke(std::forward<Function>(function), value);
+                    if (!value) return false;
+
+                    // without a placeholder, the insert needs a second lookup
+                    container.try_emplace(key, std::move(*value));
+                    return NotifyIfInserted(shard, key, true);
+                }
+            }
+
+            if (!inserted) value.emplace(std::move(it->second));
+
+            try
+            {
+                std::invoke(std::forward<Function>(function), value);
+            }
+            catch (...)
+            {
+                // the element is never left moved-from
+                if (value && !inserted) it->second = std::move(*value);
+                else container.erase(it);
+                throw;
+            }
+
+            if (!value)
+            {
+                container.erase(it);
+                return false;
+            }
+
+            it->second = std::move(*value);
+            NotifyIfInserted(shard, key, inserted);
+            return true;
         }
 
-        template<class... Args>
-        bool emplace(Args&& ...args)
-        { return emplace_helper(std::move(Guard()), std::forward<Args>(args)...); }
+        /*!
+         * @brief Inserts a value or merges it into the mapped value of an existing key.
+         * @param key   The key.
+         * @param value The value to insert. Not moved from if the key is present.
+         * @param merge Called with mapped_type& (the existing value) and the forwarded @p value if the key is present. Must not call methods of
+         *              this map.
+         * @return True if the value was inserted, false if it was merged.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<class V, class Merge>
+        bool upsert(key_type const& key, V&& value, Merge&& merge)
+        { return upsert(key, std::forward<V>(value), std::forward<Merge>(merge), Guard(key)); }
 
-        template<class... Args>
-        bool emplace(access_token const& token, Args&& ...args)
-        { return emplace_helper(token, std::forward<Args>(args)...); }
+        /*!
+         * @copydoc upsert(key_type const&, V&&, Merge&&)
+         * @param token The access token of the key's shard.
+         */
+        template<class V, class Merge>
+        bool upsert(key_type const& key, V&& value, Merge&& merge, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(key, token);
+            ThrowIfClosed();
+
+            // try_emplace leaves its arguments untouched if the key exists, so the value can still be merged
+            auto [it, inserted] = shard._container.try_emplace(key, std::forward<V>(value));
+            if (!inserted) std::invoke(std::forward<Merge>(merge), it->second, std::forward<V>(value));
 
+            return NotifyIfInserted(shard, key, inserted);
+        }
 
-        void swap(concurrent_unorderedmap& other)
-        { swap(other, std::move(Guard()), std::move(other.Guard())); }
+        /*!
+         * @brief Returns the mapped value of a key, inserting the result of @p factory if the key is not present.
+         * @param key       The key.
+         * @param factory   Called with the key if it is not present. Returns the value to insert. Must not call methods of this map.
+         * @return A copy of the mapped value.
+         *
+         * @throws ContainerClosedError If the key is not present and the container is closed.
+         */
+        template<class Factory>
+        mapped_type get_or_insert(key_type const& key, Factory&& factory)
+        { return get_or_insert(key, std::forward<Factory>(factory), Guard(key)); }
 
-        void swap(concurrent_unorderedmap& other, access_token const& myToken, access_token const& otherToken)
+        /*!
+         * @brief Returns the mapped value of a key, inserting the result of @p factory if the key is not present.
+         * @param key       The key.
+         * @param factory   Called with the key if it is not present. Returns the value to insert. Must not call methods of this map.
+         * @param token     The access token of the key's shard.
+         * @return The mapped value.
+         *
+         * @throws ContainerClosedError If the key is not present and the container is closed.
+         * @warning The reference must not be used after the token is released.
+         */
+        template<class Factory>
+        mapped_type& get_or_insert(key_type const& key, Factory&& factory, access_token const& token)
         {
-            assert(myToken.mutex()->native_handle() == _containerAccess.native_handle());
-            assert(otherToken.mutex()->native_handle() == other._containerAccess.native_handle());
+            auto& shard = PreparedShardOf(key, token);
+
+            auto it = shard._container.find(key);
+            if (it != shard._container.end()) return it->second;
 
-            // make sure both containers are not closed
             ThrowIfClosed();
-            other.ThrowIfClosed();
+            it = shard._container.try_emplace(key, std::invoke(std::forward<Factory>(factory), key)).first;
+            NotifyIfInserted(shard, key, true);
+            return it->second;
+        }
 
-            std::swap(_container, other._container);
+        /*!
+         * @brief Removes a key if its mapped value satisfies a predicate.
+         * @param key       The key.
+         * @param predicate Called with mapped_type const& if the key is present. Must not call methods of this map.
+         * @return True if the key was removed.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        template<class Predicate>
+        bool erase_if(key_type const& key, Predicate&& predicate)
+        { return erase_if(key, std::forward<Predicate>(predicate), Guard(key)); }
 
-            other._containerCV.notify_all();
-            _containerCV.notify_all();
+        /*!
+         * @copydoc erase_if(key_type const&, Predicate&&)
+         * @param token The access token of the key's shard.
+         */
+        template<class Predicate>
+        bool erase_if(key_type const& key, Predicate&& predicate, access_token const& token)
+        {
+            auto& shard = PreparedShardOf(key, token);
+            ThrowIfClosed();
+
+            auto it = shard._container.find(key);
+            if (it == shard._container.end()) return false;
+            if (!std::invoke(std::forward<Predicate>(predicate), static_cast<mapped_type const&>(it->second))) return false;
+
+            shard._container.erase(it);
+            return true;
         }
 
-        size_type erase(key_type const& key)
-        { return erase(key, std::move(Guard())); }
+        /*!
+         * @brief Calls @p function on the mapped value of a key in place, without copying it.
+         * @param key       The key.
+         * @param function  Called with mapped_type& if the key is present. Must not call methods of this map.
+         * @return True if the key is present.
+         */
+        template<class Function>
+        bool visit(key_type const& key, Function&& function)
+        { return visit(key, std::forward<Function>(function), Guard(key)); }
 
-        size_type erase(key_type const& key, access_token const& token)
+        /*!
+         * @copydoc visit(key_type const&, Function&&)
+         * @param token The access token of the key's shard.
+         */
+        template<class Function>
+        bool visit(key_type const& key, Function&& function, access_token const& token)
         {
-            CheckForOwnership(token);
-            ThrowIfClosed();
+            auto& shard = PreparedShardOf(key, token);
 
-            return _container.erase(key);
+            auto it = shard._container.find(key);
+            if (it == shard._container.end()) return false;
+
+            std::invoke(std::forward<Function>(function), it->second);
+            return true;
         }
 
+        /*!
+         * @brief Calls @p function on the mapped value of a key in place, without copying it.
+         * @param key       The key.
+         * @param function  Called with mapped_type const& if the key is present. Must not call methods of this map.
+         * @return True if the key is present.
+         */
+        template<class Function>
+        bool visit(key_type const& key, Function&& function) const
+        { return visit(key, std::forward<Function>(function), Guard(key)); }
 
-        // require external locking
         /*!
-         * Returns a reference to the mapped value of the element with key.
-         * If no such element exists, an exception of type std::out_of_range is thrown.
+         * @copydoc visit(key_type const&, Function&&) const
+         * @param token The access token of the key's shard.
          */
-        T& at(key_type const& key, access_token const& token)
+        template<class Function>
+        bool visit(key_type const& key, Function&& function, access_token const& token) const
         {
-            CheckForOwnership(token);
+            auto const* element = FindElement(OwnedShardOf(key, token), key);
+            if (element == nullptr) return false;
 
-            // reference version, this introduces race conditions!
-            // TODO: lock the container
-            return _container.at(key);
+            std::invoke(std::forward<Function>(function), element->second);
+            return true;
         }
 
         /*!
-         * Replacement for bracket operator.
-         * Returns the reference to the value that is mapped to a key, performing an insertion if such key does not already exist.
+         * @brief Blocks until a key is present, the map is closed or the timeout is reached.
+         * @details Waiters are registered per key: an insert only wakes the threads waiting for the inserted key.
+         *
+         * @param key             The key.
+         * @param maximumWaitTime The maximum time to wait.
+         * @return True if the key is present.
          */
-        T& operator()(key_type const& key, access_token const& token)
+        bool wait_for_key(key_type const& key, time_type const& maximumWaitTime = _maxWaitTime)
         {
-            CheckForOwnership(token);
+            auto token = Guard(key);
+            return WaitForKey(key, maximumWaitTime, token) != nullptr;
+        }
+
+        /*!
+         * @brief Blocks until a key is present, the map is closed or the timeout is reached, and copies its mapped value.
+         * @copydetails wait_for_key(key_type const&, time_type const&)
+         *
+         * @param key             The key.
+         * @param item            Receives the mapped value if the key is present.
+         * @param maximumWaitTime The maximum time to wait.
+         * @return True if the key is present.
+         */
+        bool wait_for_key(key_type const& key, mapped_type& item, time_type const& maximumWaitTime = _maxWaitTime)
+        {
+            auto token = Guard(key);
+
+            auto const* element = WaitForKey(key, maximumWaitTime, token);
+            if (element == nullptr) return false;
 
-            // TODO: lock the container
-            return _container[key];
+            item = element->second;
+            return true;
         }
 
-        T& operator()(key_type&& key, access_token const& token)
+        /*!
+         * @brief Removes an arbitrary element and returns it.
+         * @param key   Receives the key of the removed element.
+         * @param item  Receives the mapped value of the removed element.
+         * @return True if an element was removed, false if the map is empty.
+         *
+         * @throws ContainerClosedError If the container is closed.
+         */
+        bool pop_first(key_type& key, mapped_type& item)
         {
-            CheckForOwnership(token);
+            ThrowIfClosed();
+
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                auto& shard = _shards[i];
+                std::lock_guard<std::mutex> lock(shard._access);
+
+                auto& container = shard._container.empty() ? shard._draining : shard._container;
+                if (container.empty()) continue;
 
-            // TODO: lock the container
-            return _container[std::forward<key_type>(key)];
+                auto node = container.extract(container.begin());
+                key  = std::move(node.key());
+                item = std::move(node.mapped());
+                return true;
+            }
+
+            return false;
+        }
+
+        /*!
+         * @brief Copies the mapped values of a batch of keys.
+         * @details The keys are grouped by shard before any lock is taken. Every shard is then locked once for all its keys.
+         *
+         * @param keys  A random access range of keys.
+         * @param out   Resized to the number of keys. Receives the mapped value of each key, or nothing if the key is not present.
+         * @return The number of present keys.
+         */
+        template<class KeyRange>
+        size_type multi_get(KeyRange const& keys, std::vector<std::optional<mapped_type>>& out) const
+        {
+            auto const first = std::begin(keys);
+            out.assign(static_cast<size_type>(std::size(keys)), std::nullopt);
+
+            size_type result = 0;
+            ForEachShardOfBatch(keys, [&first](auto const& index) -> key_type const& { return first[index]; },
+                                [&](size_type index, access_token const& token)
+                                {
+                                    auto const* element = FindElement(OwnedShardOf(first[index], token), first[index]);
+                                    if (element == nullptr) return;
+
+                                    out[index] = element->second;
+                                    ++result;
+                                });
+            return result;
         }
 
-        size_type count(key_type const& key) const
-        { return count(key, std::move(Guard())); }
+        /*!
+         * @brief Inserts or assigns a batch of elements.
+         * @copydetails multi_get
+         *
+         * @param elements A random access range of key-value pairs (with first and second).
+         * @return The number of inserted elements (the others were assigned).
+         *
+         * @throws ContainerClosedError If the container is closed. Elements of shards that were processed before remain inserted.
+         */
+        template<class Range>
+        size_type multi_put(Range const& elements)
+        {
+            ThrowIfClosed();
+
+            auto const first = std::begin(elements);
 
-        size_type count(key_type const& key, access_token const& token) const
+            size_type result = 0;
+            ForEachShardOfBatch(elements, [&first](auto const& index) -> key_type const& { return first[index].first; },
+                                [&](size_type index, access_token const& token)
+                                { result += insert_or_assign(first[index].first, first[index].second, token); });
+            return result;
+        }
+
+        /*!
+         * @brief Removes a batch of keys.
+         * @copydetails multi_get
+         *
+         * @param keys A random access range of keys.
+         * @return The number of removed keys.
+         *
+         * @throws ContainerClosedError If the container is closed. Keys of shards that were processed before remain removed.
+         */
+        template<class KeyRange>
+        size_type multi_erase(KeyRange const& keys)
         {
-            CheckForOwnership(token);
+            ThrowIfClosed();
 
-            return _container.count(key);
+            auto const first = std::begin(keys);
+
+            size_type result = 0;
+            ForEachShardOfBatch(keys, [&first](auto const& index) -> key_type const& { return first[index]; },
+                                [&](size_type index, access_token const& token) { result += erase(first[index], token); });
+            return result;
         }
 
+        /*!
+         * @brief Calls @p function for every element. Shards are locked one after another.
+         * @param function Called with key_type const& and mapped_type&. Must not call methods of this map.
+         */
+        template<class Function>
+        void for_each(Function&& function)
+        {
+            ForEachShard([&function](Shard& shard)
+                         {
+                             for (auto& item : shard._container) function(item.first, item.second);
+                             for (auto& item : shard._draining) function(item.first, item.second);
+                         });
+        }
 
-        bool find(key_type const& key, T& item, access_token const& token)
+        /*!
+         * @copydoc for_each(Function&&)
+         */
+        template<class Function>
+        void for_each(Function&& function) const
         {
-            CheckForOwnership(token);
+            ForEachShard([&function](Shard const& shard)
+                         {
+                             for (auto const& item : shard._container) function(item.first, item.second);
+                             for (auto const& item : shard._draining) function(item.first, item.second);
+                         });
+        }
 
-            auto it = _container.find(key);
-            if (it == _container.end()) return false;
+    private:
+        // wakes the waiters of a key if it was inserted. The shard must be locked
+        inline bool NotifyIfInserted(Shard& shard, key_type const& key, bool inserted)
+        {
+            if (!inserted || shard._waitSlots.empty()) return inserted;
 
-            item = it->second;
+            auto slot = shard._waitSlots.find(key);
+            if (slot != shard._waitSlots.end()) slot->second._signal.notify_all();
             return true;
         }
 
-        T& get_first(access_token const& token)
+        // the element of the key, nullptr on timeout or close
+        value_type const* WaitForKey(key_type const& key, time_type const& maximumWaitTime, access_token& token)
         {
-            CheckForOwnership(token);
+            auto& shard = PreparedShardOf(key, token);
 
-            auto it = _container.begin();
-            if (it == _container.end()) throw std::out_of_range("No first element.");
+            auto const* element = FindElement(shard, key);
+            if (element != nullptr || is_closed()) return element;
 
-            return it->second;
-        }
+            // the slot reference stays valid while other keys register (unordered_map nodes are stable)
+            auto& slot = shard._waitSlots[key];
+            ++slot._waiters;
 
-        T& pop_first()
-        { return pop_first(std::move(Guard())); }
+            // an incremental rehash started while waiting may have moved the key to the draining table
+            slot._signal.wait_for(token, maximumWaitTime, [&] { return is_closed() || (element = FindElement(shard, key)) != nullptr; });
 
-        T& pop_first(access_token const& token)
-        {
-            CheckForOwnership(token);
+            if (--slot._waiters == 0) shard._waitSlots.erase(key);
+            return element;
+        }
 
-            auto it = _container.begin();
-            if (it == _container.end()) throw std::out_of_range("No first element.");
+        inline Shard& ShardOf(key_type const& key) noexcept
+        { return _shards[ShardIndex(key)]; }
 
-            // remove item
-            auto item = it->second;
-            _container.erase(it);
+        inline Shard const& ShardOf(key_type const& key) const noexcept
+        { return _shards[ShardIndex(key)]; }
 
-            return item;
+        /*!
+         * @brief Gets the shard of a key and checks that the token owns it.
+         * @note The check has no effect in no-debug builds.
+         */
+        inline Shard& OwnedShardOf(key_type const& key, access_token const& token) noexcept
+        {
+            auto& shard = ShardOf(key);
+            assert(token.owns_lock() && token.mutex() == &shard._access);
+            return shard;
         }
 
-        bool pop_key(key_type const& key, T& item)
-        { return pop_key(key, item, std::move(Guard())); }
+        inline Shard const& OwnedShardOf(key_type const& key, access_token const& token) const noexcept
+        {
+            auto const& shard = ShardOf(key);
+            assert(token.owns_lock() && token.mutex() == &shard._access);
+            return shard;
+        }
 
-        bool pop_key(key_type const& key, T& item, access_token const& token)
+        /*!
+         * @brief Gets the shard of a key for a modifying operation.
+         * @details Advances a running incremental rehash and moves the key to the current table, so the caller only needs to look at
+         * _container. Starts an incremental rehash if the next insert would rehash the shard.
+         */
+        Shard& PreparedShardOf(key_type const& key, access_token const& token)
         {
-            CheckForOwnership(token);
+            auto& shard = OwnedShardOf(key, token);
+            auto& container = shard._container;
 
-            // find the item
-            if (find(key, item, token))
+            if (shard._draining.empty())
             {
-                // and remove it
-                erase(key, token);
-                return true;
+                if (!_incrementalRehash || container.size() < IncrementalRehashMinimum) return shard;
+                if (static_cast<float>(container.size() + 1) <= container.max_load_factor() * static_cast<float>(container.bucket_count()))
+                    return shard;
+
+                // the old table keeps its elements, the new one is allocated with room for twice as many
+                container.swap(shard._draining);
+                container.reserve(2 * shard._draining.size());
             }
-            // item does not exist
-            return false;
+
+            auto node = shard._draining.extract(key);
+            if (!node.empty()) container.insert(std::move(node));
+
+            Migrate(shard, MigrationStep);
+            return shard;
         }
 
-        // iterator_type find(key_type const& key)
-        // {
-        //     auto token = Guard();
-        //     auto it    = _container.find(key);
-        //
-        //     return iterator_type(it, token);
-        // }
-        //
-        // iterator_type begin()
-        // {
-        //     auto token = Guard();
-        //     return begin(token);
-        // }
-        //
-        // iterator_type begin(access_token& token)
-        // { return iterator_type(_container.begin(), token); }
-        //
-        // iterator_type end()
-        // { return end(std::move(Guard())); }
-        //
-        // iterator_type end(access_token& token)
-        // { return iterator_type(_container.end(), token); }
+        // moves up to count elements from the draining table to the current table
+        static void Migrate(Shard& shard, size_type count)
+        {
+            for (; count != 0 && !shard._draining.empty(); --count)
+                shard._container.insert(shard._draining.extract(shard._draining.begin()));
 
+            // release the bucket array of the old table
+            if (shard._draining.empty()) shard._draining.rehash(0);
+        }
 
-    private:
-        template<class ... Args>
-        bool emplace_helper(access_token const& token, Args&& ...args)
+        // the element of a key in the current or the draining table
+        static value_type const* FindElement(Shard const& shard, key_type const& key)
         {
-            CheckForOwnership(token);
-            ThrowIfClosed();
+            auto it = shard._container.find(key);
+            if (it != shard._container.end()) return &*it;
+            if (shard._draining.empty()) return nullptr;
 
-            auto result = _container.emplace(std::forward<Args>(args)...).second;
-            _containerCV.notify_all();
-            return result;
+            it = shard._draining.find(key);
+            return it != shard._draining.end() ? &*it : nullptr;
+        }
+
+        /*!
+         * @brief Calls @p function for every index of a batch, grouped by shard.
+         * @details The shard of every key is computed (and the indices sorted by shard with a counting sort) before a lock is taken. Each shard
+         * is locked once for all its indices.
+         */
+        template<class Range, class KeyOf, class Function>
+        void ForEachShardOfBatch(Range const& range, KeyOf&& keyOf, Function&& function) const
+        {
+            auto const count = static_cast<size_type>(std::size(range));
+            if (count == 0) return;
+
+            std::vector<size_type> shardOf(count);
+            std::vector<size_type> offsets(shard_count() + 1, 0);
+            for (size_type i = 0; i < count; ++i)
+            {
+                shardOf[i] = ShardIndex(keyOf(i));
+                ++offsets[shardOf[i] + 1];
+            }
+            for (size_type i = 1; i < offsets.size(); ++i) offsets[i] += offsets[i - 1];
+
+            std::vector<size_type> order(count);
+            {
+                auto next = offsets;
+                for (size_type i = 0; i < count; ++i) order[next[shardOf[i]]++] = i;
+            }
+
+            for (size_type shardIndex = 0; shardIndex <= _shardMask; ++shardIndex)
+            {
+                auto const begin = offsets[shardIndex];
+                auto const end   = offsets[shardIndex + 1];
+                if (begin == end) continue;
+
+                auto const& shard = _shards[shardIndex];
+                access_token token(shard._access);
+
+                for (size_type i = begin; i < end; ++i) function(order[i], token);
+            }
         }
 
+        template<class Function>
+        void ForEachShard(Function&& function)
+        {
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i]._access);
+                function(_shards[i]);
+            }
+        }
+
+        template<class Function>
+        void ForEachShard(Function&& function) const
+        {
+            for (size_type i = 0; i <= _shardMask; ++i)
+            {
+                std::lock_guard<std::mutex> lock(_shards[i]._access);
+                function(static_cast<Shard const&>(_shards[i]));
+            }
+        }
     };
 }
-
-#endif
\ No newline at end of file
@@ -12,6 +12,7 @@
 #pragma once
 
 #include "concurrent_base.hpp"
+#include "locked_view.hpp"
 #include <vector>
 #include <algorithm>
 
@@ -23,19 +24,21 @@ namespace HORIZON::ALGORITHM::CONCURRENT
      * @brief A concurrent vector.
      * @copydetails concurrent_base
      *
-     * @tparam T        The element type.
-     * @tparam Alloc    The underlying allocator.
+     * @tparam T            The element type.
+     * @tparam Alloc        The underlying allocator.
+     * @tparam Container    The underlying container type. Must model std::vector (e.g. STL_EXTENSION::small_vector).
      *
      * @note This implementation is by no means complete and gets extended upon need!
      */
     template<typename T,
-             typename Alloc = std::allocator<T>>
+             typename Alloc = std::allocator<T>,
+             typename Container = std::vector<T, Alloc>>
     class concurrent_vector : public virtual concurrent_base
     {
     public:
         using value_type = T;
         using allocator_type = Alloc;
-        using container_type = std::vector<value_type, allocator_type>;
+        using container_type = Container;
         using size_type = typename container_type::size_type;
 
         using reference = value_type&;
@@ -47,6 +50,9 @@ namespace HORIZON::ALGORITHM::CONCURRENT
         using reverse_iterator = typename container_type::reverse_iterator;
         using const_reverse_iterator = typename container_type::const_reverse_iterator;
 
+        using view_type = CONCURRENT::locked_view<concurrent_vector>;
+        using const_view_type = CONCURRENT::locked_view<concurrent_vector const>;
+
 
     private:
         container_type _container;
@@ -266,8 +272,7 @@ namespace HORIZON::ALGORITHM::CONCURRENT
          * @endcode
          * This ensures that the container is locked until the iterator is out of scope (curly-brackets). It is not as nice as just using the
          * standard begin, and prevents the "default" usage of containers in stl algorithms but emphasises the need for ownership.
-         * If I feel the need
-         * for it, I'll implement a custom iterator that locks the container until it is destroyed.
+         * If you only need to iterate the container, use locked_view() instead. It owns the token for its lifetime.
          *
          * @param token The access token.
          * @warning This is inherently unsafe!
@@ -350,6 +355,21 @@ namespace HORIZON::ALGORITHM::CONCURRENT
             return _container.rend();
         }
 
+        /*!
+         * @brief Locks the container and returns a range over it.
+         * @details The view owns the access token until it is destroyed. This allows range-for loops and stl algorithms to process the whole
+         * container with a single lock acquisition.
+         * @sa locked_view
+         */
+        [[nodiscard]] inline view_type locked_view()
+        { return view_type(*this, Guard()); }
+
+        /*!
+         * @copydoc locked_view()
+         */
+        [[nodiscard]] inline const_view_type locked_view() const
+        { return const_view_type(*this, Guard()); }
+
         /*!
          * @brief Clears the container.
          *
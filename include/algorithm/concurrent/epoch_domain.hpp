@@ -0,0 +1,362 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 23:40
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief Epoch based memory reclamation for lock-free data structures.
+     *
+     * @details A lock-free structure cannot free a node it unlinked, another thread may still read it. Instead, the node is retired to the
+     * domain and freed once every thread that could have seen it has left its critical region:
+     *
+     * - Readers and writers access the structure inside a guard (pin()). A guard publishes the global epoch the thread entered with.
+     * - retire(pointer, deleter) tags an unlinked object with the current epoch and appends it to the retire list of the calling thread.
+     * - Every batch_size() retires, the thread advances the global epoch and frees its objects that are older than the oldest epoch pinned by
+     *   any thread. A retired object can only be reached by threads that entered before it was unlinked, so those objects are unreachable.
+     *
+     * Threads register implicitly: the first guard of a thread claims a per thread record (reused by later guards of the thread, like the
+     * reader records of concurrent_rcumap). Records are only held while a guard is alive, so threads may come and go without deregistering;
+     * the retire list of a record is taken over by the next thread claiming it, reclaim() drains the lists of all idle records.
+     *
+     * Memory is bounded as long as guards are short: a thread that stays pinned blocks the reclamation of everything retired after it entered.
+     *
+     * @note Deleters must not throw. They run inside the guard of the reclaiming thread.
+     */
+    class epoch_domain
+    {
+    public:
+        using size_type = std::size_t;
+
+        /*!
+         * @brief The default number of retires of a thread between two reclamation attempts.
+         */
+        static constexpr const size_type DefaultBatchSize = 64;
+
+    private:
+        struct Retired
+        {
+            void* _pointer;
+            void (* _reclaim)(void*);
+            std::uint64_t _epoch;
+        };
+
+        // the epoch a guard entered with (0 outside of guards) and the retired objects of the claiming thread
+        struct alignas(64) Record
+        {
+            std::atomic<std::uint64_t> _pinned{ 0 };
+            std::atomic_bool           _claimed{ false };
+            Record*                    _next = nullptr;
+
+            // only accessed by the claiming thread
+            std::vector<Retired> _retired;
+            size_type            _nextReclaim = 0;
+        };
+
+        // the record of the current guard of this thread. Nested guards of the same domain reuse it
+        struct Hint
+        {
+            std::uint64_t _domain = 0;
+            Record*       _record = nullptr;
+            size_type     _depth  = 0;
+        };
+
+        // identifies a domain for the thread local hint. Never reused, unlike addresses
+        static inline std::atomic<std::uint64_t> NextId{ 1 };
+
+        std::uint64_t const          _id = NextId.fetch_add(1);
+        std::atomic<std::uint64_t>   _epoch{ 1 };
+        mutable std::atomic<Record*> _records{ nullptr };
+        std::atomic<size_type>       _pending{ 0 };
+        size_type const              _batchSize;
+
+    public:
+        /*!
+         * @brief A critical region. Objects retired to the domain are not freed while a guard that could have seen them is alive.
+         * @details Created by pin(). Guards are bound to the creating thread and must be destroyed in reverse order of creation.
+         */
+        class guard
+        {
+            friend class epoch_domain;
+
+        private:
+            epoch_domain* _domain;
+            Record*       _record;
+            bool          _outermost;
+
+            guard(epoch_domain* domain, Record* record, bool outermost) noexcept :
+                    _domain(domain),
+                    _record(record),
+                    _outermost(outermost)
+            { }
+
+        public:
+            guard(guard const&) = delete;
+            guard& operator=(guard const&) = delete;
+
+            ~guard()
+            { _domain->Unpin(_record, _outermost); }
+
+            /*!
+             * @brief Retires an object. Same as epoch_domain::retire, without looking up the record of the thread.
+             */
+            template<class T, class Deleter = std::default_delete<T>>
+            inline void retire(T* pointer, Deleter deleter = Deleter())
+            { _domain->Retire(*_record, pointer, std::move(deleter)); }
+        };
+
+        /*!
+         * @brief Creates a domain.
+         * @param batchSize The number of retires of a thread between two reclamation attempts. Larger batches amortise the scan over the
+         * thread records better, smaller batches bound the retired memory tighter.
+         */
+        explicit epoch_domain(size_type batchSize = DefaultBatchSize) :
+                _batchSize(std::max<size_type>(1, batchSize))
+        { }
+
+        epoch_domain(epoch_domain const&) = delete;
+        epoch_domain& operator=(epoch_domain const&) = delete;
+
+        /*!
+         * @brief Frees all retired objects and destroys the domain. No guard may be alive.
+         */
+        ~epoch_domain()
+        {
+            // deleters may retire further objects (to any record, even to a new one), so drain until every list stays empty
+            for (bool drained = false; !drained;)
+            {
+                drained = true;
+                for (Record* record = _records.load(); record != nullptr; record = record->_next)
+                {
+                    std::vector<Retired> retired;
+                    retired.swap(record->_retired);
+
+                    drained = drained && retired.empty();
+                    for (auto const& object : retired) object._reclaim(object._pointer);
+                }
+            }
+
+            for (Record* record = _records.load(); record != nullptr;)
+            {
+                Record* next = record->_next;
+                delete record;
+                record = next;
+            }
+        }
+
+        /*!
+         * @brief Enters a critical region.
+         * @details Registers the thread on its first call. Nested guards of the same thread are cheap, they only increase a counter.
+         * @return The guard, the region ends with its destruction.
+         */
+        [[nodiscard]] guard pin()
+        {
+            auto& hint = ThreadHint();
+            if (hint._domain == _id && hint._depth > 0)
+            {
+                ++hint._depth;
+                return guard(this, hint._record, false);
+            }
+
+            Record* record = Claim(hint);
+
+            // sequentially consistent exchange: the pin is visible to reclaiming threads before this thread loads any shared pointer
+            record->_pinned.exchange(_epoch.load());
+
+            if (hint._depth == 0)
+            {
+                hint = { _id, record, 1 };
+            }
+            return guard(this, record, true);
+        }
+
+        /*!
+         * @brief Retires an unlinked object: @p deleter is called with @p pointer once no guard can reach the object anymore.
+         * @details May be called inside or outside of a guard. Every batch_size() retires of a thread, the thread tries to reclaim its
+         * retired objects. Deleters without state (e.g. std::default_delete) are stored as a function pointer, others are moved to the heap.
+         *
+         * @param pointer The object. Must not be reachable for guards entered after this call.
+         * @param deleter Frees the object. Must not throw.
+         */
+        template<class T, class Deleter = std::default_delete<T>>
+        void retire(T* pointer, Deleter deleter = Deleter())
+        {
+            auto& hint = ThreadHint();
+            if (hint._domain == _id && hint._depth > 0) return Retire(*hint._record, pointer, std::move(deleter));
+
+            auto scope = pin();
+            scope.retire(pointer, std::move(deleter));
+        }
+
+        /*!
+         * @brief Advances the epoch and frees the retired objects of this thread and of all idle threads that no guard can reach anymore.
+         * @details Reclamation also happens automatically during retire. Call this e.g. after a burst of retires or before measuring memory.
+         * @return The number of freed objects.
+         */
+        size_type reclaim()
+        {
+            _epoch.fetch_add(1);
+
+            // pinned after the advance, so the guard does not hold back the objects retired before. The deleters run inside of it
+            auto const scope  = pin();
+            size_type  result = Reclaim(*scope._record);
+
+            for (Record* record = _records.load(); record != nullptr; record = record->_next)
+            {
+                bool expected = false;
+                if (!record->_claimed.compare_exchange_strong(expected, true)) continue;
+
+                result += Reclaim(*record);
+                record->_claimed.store(false, std::memory_order_release);
+            }
+            return result;
+        }
+
+        /*!
+         * @return The number of retired objects not yet freed.
+         */
+        [[nodiscard]] inline size_type pending() const noexcept
+        { return _pending.load(std::memory_order_relaxed); }
+
+        /*!
+         * @return The number of retires of a thread between two reclamation attempts.
+         */
+        [[nodiscard]] inline size_type batch_size() const noexcept
+        { return _batchSize; }
+
+        /*!
+         * @return The current global epoch.
+         */
+        [[nodiscard]] inline std::uint64_t epoch() const noexcept
+        { return _epoch.load(); }
+
+    private:
+        static Hint& ThreadHint() noexcept
+        {
+            thread_local Hint hint;
+            return hint;
+        }
+
+        /*!
+         * @brief Claims an idle record for the calling thread.
+         * @details The record of the last guard of this thread is tried first. It is usually idle and still holds the retire list of this
+         * thread.
+         */
+        Record* Claim(Hint const& hint)
+        {
+            bool expected = false;
+            if (hint._domain == _id && hint._record->_claimed.compare_exchange_strong(expected, true)) return hint._record;
+
+            for (Record* record = _records.load(); record != nullptr; record = record->_next)
+            {
+                expected = false;
+                if (record->_claimed.compare_exchange_strong(expected, true)) return record;
+            }
+
+            // more concurrent threads than records: register a new one
+            auto* record = new Record();
+            record->_claimed.store(true, std::memory_order_relaxed);
+            record->_nextReclaim = _batchSize;
+            record->_next = _records.load();
+            while (!_records.compare_exchange_weak(record->_next, record)) { }
+
+            return record;
+        }
+
+        void Unpin(Record* record, bool outermost) noexcept
+        {
+            auto& hint = ThreadHint();
+            if (!outermost)
+            {
+                --hint._depth;
+                return;
+            }
+
+            if (hint._domain == _id && hint._record == record) hint._depth = 0;
+
+            record->_pinned.store(0, std::memory_order_release);
+            record->_claimed.store(false, std::memory_order_release);
+        }
+
+        template<class T, class Deleter>
+        void Retire(Record& record, T* pointer, Deleter deleter)
+        {
+            if (pointer == nullptr) return;
+
+            if constexpr (std::is_empty_v<Deleter> && std::is_default_constructible_v<Deleter>)
+            {
+                record._retired.push_back({ pointer, [](void* object) { Deleter()(static_cast<T*>(object)); }, _epoch.load() });
+            }
+            else
+            {
+                using holder_type = std::pair<T*, Deleter>;
+
+                auto holder = std::make_unique<holder_type>(pointer, std::move(deleter));
+                record._retired.push_back({ holder.get(),
+                                            [](void* object)
+                                            {
+                                                std::unique_ptr<holder_type> owner(static_cast<holder_type*>(object));
+                                                owner->second(owner->first);
+                                            },
+                                            _epoch.load() });
+                holder.release();
+            }
+            _pending.fetch_add(1, std::memory_order_relaxed);
+
+            if (record._retired.size() >= record._nextReclaim)
+            {
+                _epoch.fetch_add(1);
+                Reclaim(record);
+
+                // objects kept alive by a slow guard are not scanned again on every retire
+                record._nextReclaim = record._retired.size() + _batchSize;
+            }
+        }
+
+        // frees the objects of a claimed record that are older than every pinned epoch
+        size_type Reclaim(Record& record)
+        {
+            if (record._retired.empty()) return 0;
+
+            auto oldest = std::numeric_limits<std::uint64_t>::max();
+            for (Record* other = _records.load(); other != nullptr; other = other->_next)
+            {
+                auto const pinned = other->_pinned.load();
+                if (pinned != 0) oldest = std::min(oldest, pinned);
+            }
+
+            // guards that pinned a later epoch entered after the object was unlinked
+            auto const end = std::partition(record._retired.begin(), record._retired.end(),
+                                            [oldest](Retired const& retired) { return retired._epoch >= oldest; });
+
+            // deleters may retire further objects (e.g. the children of a node), so the list must be consistent before they run
+            std::vector<Retired> freeable(end, record._retired.end());
+            record._retired.erase(end, record._retired.end());
+
+            for (auto const& retired : freeable) retired._reclaim(retired._pointer);
+            _pending.fetch_sub(freeable.size(), std::memory_order_relaxed);
+            return freeable.size();
+        }
+    };
+}
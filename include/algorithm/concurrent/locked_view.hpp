@@ -0,0 +1,134 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 18:50
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <utility>
+#include <iterator>
+
+#include "algorithm/concurrent/concurrent_base.hpp"
+
+namespace HORIZON::ALGORITHM::CONCURRENT
+{
+    /*!
+     * @ingroup group_algorithm_concurrent
+     *
+     * @brief A range over a concurrent container that owns the container lock for its whole lifetime.
+     *
+     * @details This is the "custom iterator that locks the container" mentioned in concurrent_vector::begin(access_token const&). Instead of
+     * locking per iterator, the view acquires the access token once and hands out the plain container iterators. This allows range-for loops and
+     * stl algorithms without per-element overhead:
+     * @code{.cpp}
+     * {
+     *      auto view = container.locked_view();
+     *      std::sort(view.begin(), view.end());
+     *      for (auto& item : view) { ... }
+     * }
+     * @endcode
+     * The container is released once the view goes out of scope (or unlock() is called).
+     *
+     * @tparam Container The concurrent container type. Must provide size, begin and end overloads taking an access_token. May be const.
+     *
+     * @warning Iterators obtained from the view must not be used after the view is destroyed or unlocked.
+     */
+    template<class Container>
+    class locked_view
+    {
+    public:
+        using container_type = Container;
+        using access_token = concurrent_base::access_token;
+        using size_type = typename std::remove_const_t<Container>::size_type;
+
+        using iterator = decltype(std::declval<Container&>().begin(std::declval<access_token const&>()));
+        using const_iterator = decltype(std::declval<Container const&>().begin(std::declval<access_token const&>()));
+
+        using reference = typename std::iterator_traits<iterator>::reference;
+        using const_reference = typename std::iterator_traits<const_iterator>::reference;
+
+    private:
+        Container* _container;
+        access_token _token;
+
+    public:
+        /*!
+         * @brief Creates a view and takes ownership of the container.
+         * @param container The container to view.
+         * @param token     The access token of the container. The view takes over the token.
+         */
+        locked_view(Container& container, access_token&& token) :
+                _container(&container),
+                _token(std::move(token))
+        { }
+
+        locked_view(locked_view const&) = delete;
+        locked_view& operator=(locked_view const&) = delete;
+
+        locked_view(locked_view&&) noexcept = default;
+        locked_view& operator=(locked_view&&) noexcept = default;
+
+        /*!
+         * @return The access token held by this view. Can be passed to all locked container methods.
+         */
+        [[nodiscard]] inline access_token const& token() const noexcept
+        { return _token; }
+
+        /*!
+         * @return True if the view still owns the container.
+         */
+        [[nodiscard]] inline bool owns_lock() const noexcept
+        { return _token.owns_lock(); }
+
+        /*!
+         * @brief Releases the container. The view must not be used afterwards.
+         */
+        inline void unlock()
+        { _token.unlock(); }
+
+
+        [[nodiscard]] inline size_type size() const
+        { return _container->size(_token); }
+
+        [[nodiscard]] inline bool empty() const
+        { return _container->empty(_token); }
+
+        inline iterator begin() noexcept
+        { return _container->begin(_token); }
+
+        inline iterator end() noexcept
+        { return _container->end(_token); }
+
+        inline const_iterator begin() const noexcept
+        { return std::as_const(*_container).begin(_token); }
+
+        inline const_iterator end() const noexcept
+        { return std::as_const(*_container).end(_token); }
+
+        inline const_iterator cbegin() const noexcept
+        { return begin(); }
+
+        inline const_iterator cend() const noexcept
+        { return end(); }
+
+        /*!
+         * @brief Accesses an element without bounds checking.
+         * @param index The index of the element.
+         * @return A reference to the element.
+         */
+        inline reference operator[](size_type index) noexcept
+        { return begin()[index]; }
+
+        /*!
+         * @copydoc operator[](size_type)
+         */
+        inline const_reference operator[](size_type index) const noexcept
+        { return begin()[index]; }
+    };
+}
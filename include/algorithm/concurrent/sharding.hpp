@@ -0,0 +1,52 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 23:40
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <algorithm>
+#include <thread>
+
+namespace HORIZON::ALGORITHM::CONCURRENT::SHARDING
+{
+    /*!
+     * @return The smallest power of two that is not less than @p value (1 for 0).
+     */
+    constexpr std::size_t RoundUpToPowerOfTwo(std::size_t value) noexcept
+    {
+        std::size_t result = 1;
+        while (result < value) result <<= 1u;
+        return result;
+    }
+
+    /*!
+     * @return The default number of shards of the sharded containers: four per hardware thread, rounded up to a power of two.
+     */
+    inline std::size_t DefaultShardCount() noexcept
+    { return RoundUpToPowerOfTwo(4 * std::max(1u, std::thread::hardware_concurrency())); }
+
+    /*!
+     * @brief Fibonacci hashing: multiplies with 2^64 / golden ratio.
+     * @details Spreads weak hashes (e.g. the identity hash of integers) over the high bits. Use the high bits to select a shard, the low bits
+     * of the original hash remain independent for the buckets inside the shard.
+     */
+    constexpr std::uint64_t FibonacciMix(std::uint64_t hash) noexcept
+    { return hash * UINT64_C(0x9E3779B97F4A7C15); }
+
+    /*!
+     * @param hash      The hash of the key.
+     * @param shardMask The number of shards minus one. The number of shards must be a power of two.
+     * @return The index of the shard of the key.
+     */
+    constexpr std::size_t ShardIndex(std::uint64_t hash, std::size_t shardMask) noexcept
+    { return static_cast<std::size_t>(FibonacciMix(hash) >> 40) & shardMask; }
+}
@@ -12,6 +12,11 @@
 #pragma once
 
 #include <cstdint>
+#include <cstddef>
+#include <array>
+#include <string_view>
+
+#include "algorithm/stl_extension/simd_search.hpp"
 
 namespace HORIZON::ALGORITHM::STL_EXTENSION
 {
@@ -47,4 +52,269 @@ namespace HORIZON::ALGORITHM::STL_EXTENSION
 
         return character;
     }
+
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief The reason a hex string could not be decoded.
+     */
+    enum class HexDecodeError
+    {
+        None,
+        //! The string has an odd number of characters.
+        OddLength,
+        //! A character is not a hex digit.
+        InvalidDigit
+    };
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief The result of HexDecode.
+     */
+    struct HexDecodeResult
+    {
+        HexDecodeError error = HexDecodeError::None;
+        /*!
+         * @brief The index of the first invalid character (InvalidDigit) or the length of the string.
+         */
+        std::size_t position = 0;
+
+        explicit constexpr operator bool() const noexcept
+        { return error == HexDecodeError::None; }
+    };
+}
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION::SIMD::KERNEL
+{
+    // the value of each character as a hex digit or 0xFF
+    inline constexpr std::array<std::uint8_t, 256> HexValues = []
+    {
+        std::array<std::uint8_t, 256> values{ };
+        for (auto& value : values) value = 0xFF;
+        for (unsigned i = 0; i < 10; ++i) values['0' + i] = static_cast<std::uint8_t>(i);
+        for (unsigned i = 0; i < 6; ++i)
+        {
+            values['a' + i] = static_cast<std::uint8_t>(10 + i);
+            values['A' + i] = static_cast<std::uint8_t>(10 + i);
+        }
+        return values;
+    }();
+
+    inline constexpr char const HexDigitsLower[] = "0123456789abcdef";
+    inline constexpr char const HexDigitsUpper[] = "0123456789ABCDEF";
+
+    // decodes bytes [start, size). Returns the index of the first invalid character or size * 2.
+    inline std::size_t HexDecodeScalar(char const* text, std::size_t size, std::uint8_t* bytes, std::size_t start = 0) noexcept
+    {
+        for (std::size_t i = start; i < size; ++i)
+        {
+            auto const high = HexValues[static_cast<unsigned char>(text[2 * i])];
+            auto const low  = HexValues[static_cast<unsigned char>(text[2 * i + 1])];
+            if ((high | low) > 0xF) return 2 * i + (high > 0xF ? 0 : 1);
+
+            bytes[i] = static_cast<std::uint8_t>((high << 4u) | low);
+        }
+        return 2 * size;
+    }
+
+    inline void HexEncodeScalar(std::uint8_t const* bytes, std::size_t size, char* text, char const* digits, std::size_t start = 0) noexcept
+    {
+        for (std::size_t i = start; i < size; ++i)
+        {
+            text[2 * i]     = digits[bytes[i] >> 4u];
+            text[2 * i + 1] = digits[bytes[i] & 0xFu];
+        }
+    }
+
+    // flips the case (bit 0x20) of the characters in [first, last]
+    inline void FlipCaseScalar(char* text, std::size_t length, char first, char last, std::size_t start = 0) noexcept
+    {
+        for (std::size_t i = start; i < length; ++i)
+        {
+            if (text[i] >= first && text[i] <= last) text[i] = static_cast<char>(text[i] ^ 0x20);
+        }
+    }
+
+#if HORIZON_ALGORITHM_SIMD_X86
+    // converts 16 hex characters to their values. Returns false if any character is not a hex digit.
+    __attribute__((target("sse4.1"))) inline bool HexToNibbles128(__m128i characters, __m128i& nibbles) noexcept
+    {
+        // characters >= 0x80 are negative and fail both range checks
+        __m128i const lowerCase = _mm_or_si128(characters, _mm_set1_epi8(0x20));
+        __m128i const isDigit   = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('0' - 1)),
+                                                _mm_cmplt_epi8(characters, _mm_set1_epi8('9' + 1)));
+        __m128i const isLetter  = _mm_and_si128(_mm_cmpgt_epi8(lowerCase, _mm_set1_epi8('a' - 1)),
+                                                _mm_cmplt_epi8(lowerCase, _mm_set1_epi8('f' + 1)));
+
+        nibbles = _mm_blendv_epi8(_mm_sub_epi8(lowerCase, _mm_set1_epi8('a' - 10)), _mm_sub_epi8(characters, _mm_set1_epi8('0')), isDigit);
+        return _mm_movemask_epi8(_mm_or_si128(isDigit, isLetter)) == 0xFFFF;
+    }
+
+    // 32 characters to 16 bytes per step. Stops at the first block with an invalid character, returns the number of decoded bytes.
+    __attribute__((target("sse4.1"))) inline std::size_t HexDecodeSSE41(char const* text, std::size_t size, std::uint8_t* bytes) noexcept
+    {
+        // first * 16 + second for each pair of nibbles
+        __m128i const weights = _mm_set1_epi16(0x0110);
+
+        std::size_t i = 0;
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i upper;
+            __m128i lower;
+            bool const valid = HexToNibbles128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(text + 2 * i)), upper) &
+                               HexToNibbles128(_mm_loadu_si128(reinterpret_cast<__m128i const*>(text + 2 * i + 16)), lower);
+            if (!valid) break;
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(bytes + i),
+                             _mm_packus_epi16(_mm_maddubs_epi16(upper, weights), _mm_maddubs_epi16(lower, weights)));
+        }
+        return i;
+    }
+
+    // 16 bytes to 32 characters per step. Returns the number of encoded bytes.
+    __attribute__((target("sse4.1"))) inline std::size_t HexEncodeSSE41(std::uint8_t const* bytes, std::size_t size, char* text, char const* digits) noexcept
+    {
+        __m128i const table      = _mm_loadu_si128(reinterpret_cast<__m128i const*>(digits));
+        __m128i const nibbleMask = _mm_set1_epi8(0x0F);
+
+        std::size_t i = 0;
+        for (; i + 16 <= size; i += 16)
+        {
+            __m128i const block       = _mm_loadu_si128(reinterpret_cast<__m128i const*>(bytes + i));
+            __m128i const highNibbles = _mm_and_si128(_mm_srli_epi16(block, 4), nibbleMask);
+            __m128i const lowNibbles  = _mm_and_si128(block, nibbleMask);
+
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + 2 * i), _mm_shuffle_epi8(table, _mm_unpacklo_epi8(highNibbles, lowNibbles)));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + 2 * i + 16), _mm_shuffle_epi8(table, _mm_unpackhi_epi8(highNibbles, lowNibbles)));
+        }
+        return i;
+    }
+
+    inline void FlipCaseSSE2(char* text, std::size_t length, char first, char last) noexcept
+    {
+        __m128i const lowerBound = _mm_set1_epi8(static_cast<char>(first - 1));
+        __m128i const upperBound = _mm_set1_epi8(static_cast<char>(last + 1));
+        __m128i const caseBit    = _mm_set1_epi8(0x20);
+
+        std::size_t i = 0;
+        for (; i + 16 <= length; i += 16)
+        {
+            // characters >= 0x80 are negative and never in range
+            __m128i const block   = _mm_loadu_si128(reinterpret_cast<__m128i const*>(text + i));
+            __m128i const inRange = _mm_and_si128(_mm_cmpgt_epi8(block, lowerBound), _mm_cmplt_epi8(block, upperBound));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(text + i), _mm_xor_si128(block, _mm_and_si128(inRange, caseBit)));
+        }
+        FlipCaseScalar(text, length, first, last, i);
+    }
+
+    __attribute__((target("avx2"))) inline void FlipCaseAVX2(char* text, std::size_t length, char first, char last) noexcept
+    {
+        __m256i const lowerBound = _mm256_set1_epi8(static_cast<char>(first - 1));
+        __m256i const upperBound = _mm256_set1_epi8(static_cast<char>(last + 1));
+        __m256i const caseBit    = _mm256_set1_epi8(0x20);
+
+        std::size_t i = 0;
+        for (; i + 32 <= length; i += 32)
+        {
+            __m256i const block   = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(text + i));
+            __m256i const inRange = _mm256_and_si256(_mm256_cmpgt_epi8(block, lowerBound), _mm256_cmpgt_epi8(upperBound, block));
+            _mm256_storeu_si256(reinterpret_cast<__m256i*>(text + i), _mm256_xor_si256(block, _mm256_and_si256(inRange, caseBit)));
+        }
+        FlipCaseScalar(text, length, first, last, i);
+    }
+#endif
+
+    inline void FlipCase(char* text, std::size_t length, char first, char last) noexcept
+    {
+#if HORIZON_ALGORITHM_SIMD_X86
+        switch (DetectSimdLevel())
+        {
+            case SimdLevel::AVX2: return FlipCaseAVX2(text, length, first, last);
+            case SimdLevel::SSE41:
+            case SimdLevel::SSE2: return FlipCaseSSE2(text, length, first, last);
+            default: break;
+        }
+#endif
+        FlipCaseScalar(text, length, first, last);
+    }
+}
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Encodes bytes as hex characters, two per byte, most significant nibble first.
+     * @details Uses SSE4.1 (16 bytes per step) if the CPU supports it, otherwise a lookup table.
+     *
+     * @param bytes     The bytes.
+     * @param size      The number of bytes.
+     * @param text      The output. Must hold at least size * 2 characters, no terminating NUL is written.
+     * @param upperCase True for A-F, false for a-f.
+     * @return A pointer past the last written character.
+     */
+    inline char* HexEncode(void const* bytes, std::size_t size, char* text, bool upperCase = false) noexcept
+    {
+        auto const* input  = static_cast<std::uint8_t const*>(bytes);
+        auto const* digits = upperCase ? SIMD::KERNEL::HexDigitsUpper : SIMD::KERNEL::HexDigitsLower;
+
+        std::size_t done = 0;
+#if HORIZON_ALGORITHM_SIMD_X86
+        if (SIMD::DetectSimdLevel() >= SIMD::SimdLevel::SSE41) done = SIMD::KERNEL::HexEncodeSSE41(input, size, text, digits);
+#endif
+        SIMD::KERNEL::HexEncodeScalar(input, size, text, digits, done);
+        return text + 2 * size;
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Decodes a string of hex characters (upper or lower case) into bytes, two characters per byte.
+     * @details Uses SSE4.1 (32 characters per step) if the CPU supports it, otherwise a lookup table. Unlike HexCharToByte, invalid
+     * characters are reported instead of passed through.
+     *
+     * @param text  The hex string.
+     * @param bytes The output. Must hold at least text.size() / 2 bytes. On error, the bytes before the invalid character are written.
+     * @return The error and the position of the first invalid character. Evaluates to true on success.
+     */
+    inline HexDecodeResult HexDecode(std::string_view text, void* bytes) noexcept
+    {
+        if (text.size() % 2 != 0) return { HexDecodeError::OddLength, text.size() };
+
+        auto* output     = static_cast<std::uint8_t*>(bytes);
+        auto const size  = text.size() / 2;
+
+        std::size_t done = 0;
+#if HORIZON_ALGORITHM_SIMD_X86
+        if (SIMD::DetectSimdLevel() >= SIMD::SimdLevel::SSE41) done = SIMD::KERNEL::HexDecodeSSE41(text.data(), size, output);
+#endif
+        auto const position = SIMD::KERNEL::HexDecodeScalar(text.data(), size, output, done);
+        if (position != text.size()) return { HexDecodeError::InvalidDigit, position };
+
+        return { HexDecodeError::None, text.size() };
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Converts the characters a-z of a buffer to upper case in place.
+     * @details Other characters, including non-ASCII (UTF-8) bytes, are not modified. Uses SSE2/AVX2 (selected at runtime).
+     * @param text      The characters.
+     * @param length    The number of characters.
+     */
+    inline void ToUpper(char* text, std::size_t length) noexcept
+    { SIMD::KERNEL::FlipCase(text, length, 'a', 'z'); }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Converts the characters A-Z of a buffer to lower case in place.
+     * @details Other characters, including non-ASCII (UTF-8) bytes, are not modified. Uses SSE2/AVX2 (selected at runtime).
+     * @param text      The characters.
+     * @param length    The number of characters.
+     */
+    inline void ToLower(char* text, std::size_t length) noexcept
+    { SIMD::KERNEL::FlipCase(text, length, 'A', 'Z'); }
 }
@@ -0,0 +1,473 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 20:40
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <numeric>
+#include <stdexcept>
+#include <utility>
+
+#include "algorithm/stl_extension/lower_bound.hpp"
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A sorted map stored in two contiguous containers.
+     * @details Keys and mapped values live in separate containers. Lookups only touch the (dense) key array and use BranchlessLowerBound, the
+     * mapped value is accessed once the position is known. Iterators dereference to std::pair<key_type const&, mapped_type&>.
+     *
+     * As with flat_set, bulk insertion via insert(InputIt, InputIt) is preferred over single inserts.
+     *
+     * @tparam Key              The key type.
+     * @tparam T                The mapped type.
+     * @tparam Compare          The ordering of the keys.
+     * @tparam KeyContainer     The underlying contiguous key container.
+     * @tparam MappedContainer  The underlying contiguous mapped value container.
+     */
+    template<typename Key,
+             typename T,
+             class Compare = std::less<Key>,
+             class KeyContainer = std::vector<Key>,
+             class MappedContainer = std::vector<T>>
+    class flat_map
+    {
+    public:
+        using key_type = Key;
+        using mapped_type = T;
+        using value_type = std::pair<key_type, mapped_type>;
+        using key_compare = Compare;
+        using key_container_type = KeyContainer;
+        using mapped_container_type = MappedContainer;
+        using size_type = std::size_t;
+
+    private:
+        template<bool Const>
+        class iterator_base
+        {
+            friend class flat_map;
+            template<bool> friend class iterator_base;
+            using map_pointer = std::conditional_t<Const, flat_map const*, flat_map*>;
+            using mapped_reference = std::conditional_t<Const, mapped_type const&, mapped_type&>;
+
+        public:
+            // the reference is a proxy, so this is only a legacy input iterator. C++20 algorithms see the random access capabilities.
+            using iterator_category = std::input_iterator_tag;
+            using iterator_concept = std::random_access_iterator_tag;
+            using value_type = typename flat_map::value_type;
+            using difference_type = std::ptrdiff_t;
+            using reference = std::pair<key_type const&, mapped_reference>;
+
+            // operator-> has to return a pointer-like object for a temporary pair
+            struct pointer
+            {
+                reference _reference;
+
+                reference* operator->() noexcept
+                { return &_reference; }
+            };
+
+        private:
+            map_pointer _map   = nullptr;
+            size_type   _index = 0;
+
+            iterator_base(map_pointer map, size_type index) :
+                    _map(map),
+                    _index(index)
+            { }
+
+        public:
+            iterator_base() = default;
+
+            // allow iterator -> const_iterator
+            template<bool OtherConst, typename = std::enable_if_t<Const && !OtherConst>>
+            iterator_base(iterator_base<OtherConst> const& other) :
+                    _map(other._map),
+                    _index(other._index)
+            { }
+
+            [[nodiscard]] inline size_type index() const noexcept
+            { return _index; }
+
+            inline reference operator*() const
+            { return reference(_map->_keys[_index], _map->_values[_index]); }
+
+            inline pointer operator->() const
+            { return pointer{ **this }; }
+
+            inline reference operator[](difference_type offset) const
+            { return *(*this + offset); }
+
+            inline iterator_base& operator++() noexcept
+            {
+                ++_index;
+                return *this;
+            }
+
+            inline iterator_base operator++(int) noexcept
+            {
+                auto copy = *this;
+                ++_index;
+                return copy;
+            }
+
+            inline iterator_base& operator--() noexcept
+            {
+                --_index;
+                return *this;
+            }
+
+            inline iterator_base operator--(int) noexcept
+            {
+                auto copy = *this;
+                --_index;
+                return copy;
+            }
+
+            inline iterator_base& operator+=(difference_type offset) noexcept
+            {
+                _index += offset;
+                return *this;
+            }
+
+            inline iterator_base& operator-=(difference_type offset) noexcept
+            {
+                _index -= offset;
+                return *this;
+            }
+
+            friend iterator_base operator+(iterator_base it, difference_type offset) noexcept
+            { return it += offset; }
+
+            friend iterator_base operator+(difference_type offset, iterator_base it) noexcept
+            { return it += offset; }
+
+            friend iterator_base operator-(iterator_base it, difference_type offset) noexcept
+            { return it -= offset; }
+
+            friend difference_type operator-(iterator_base const& left, iterator_base const& right) noexcept
+            { return static_cast<difference_type>(left._index) - static_cast<difference_type>(right._index); }
+
+            friend bool operator==(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index == right._index; }
+
+            friend bool operator!=(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index != right._index; }
+
+            friend bool operator<(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index < right._index; }
+
+            friend bool operator>(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index > right._index; }
+
+            friend bool operator<=(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index <= right._index; }
+
+            friend bool operator>=(iterator_base const& left, iterator_base const& right) noexcept
+            { return left._index >= right._index; }
+        };
+
+    public:
+        using iterator = iterator_base<false>;
+        using const_iterator = iterator_base<true>;
+
+    private:
+        key_container_type    _keys;
+        mapped_container_type _values;
+        key_compare           _compare;
+
+    public:
+        flat_map() = default;
+
+        explicit flat_map(key_compare const& compare) :
+                _compare(compare)
+        { }
+
+        /*!
+         * @brief Creates a map from an unsorted range of key-value pairs. For duplicate keys, the first occurrence is kept.
+         */
+        template<class InputIt>
+        flat_map(InputIt first, InputIt last, key_compare const& compare = key_compare()) :
+                _compare(compare)
+        { insert(first, last); }
+
+        flat_map(std::initializer_list<value_type> list, key_compare const& compare = key_compare()) :
+                flat_map(list.begin(), list.end(), compare)
+        { }
+
+
+        [[nodiscard]] inline size_type size() const noexcept
+        { return _keys.size(); }
+
+        [[nodiscard]] inline bool empty() const noexcept
+        { return _keys.empty(); }
+
+        inline void reserve(size_type size)
+        {
+            _keys.reserve(size);
+            _values.reserve(size);
+        }
+
+        inline void clear() noexcept
+        {
+            _keys.clear();
+            _values.clear();
+        }
+
+        /*!
+         * @return The sorted keys.
+         */
+        [[nodiscard]] inline key_container_type const& keys() const noexcept
+        { return _keys; }
+
+        /*!
+         * @return The mapped values, in key order.
+         */
+        [[nodiscard]] inline mapped_container_type const& values() const noexcept
+        { return _values; }
+
+        [[nodiscard]] inline key_compare key_comp() const
+        { return _compare; }
+
+        inline iterator begin() noexcept
+        { return iterator(this, 0); }
+
+        inline iterator end() noexcept
+        { return iterator(this, size()); }
+
+        inline const_iterator begin() const noexcept
+        { return const_iterator(this, 0); }
+
+        inline const_iterator end() const noexcept
+        { return const_iterator(this, size()); }
+
+        inline const_iterator cbegin() const noexcept
+        { return begin(); }
+
+        inline const_iterator cend() const noexcept
+        { return end(); }
+
+
+        /*!
+         * @brief Inserts a key-value pair if the key is not present.
+         * @return The position of the element and true if it was inserted.
+         */
+        std::pair<iterator, bool> insert(value_type const& value)
+        { return try_emplace(value.first, value.second); }
+
+        /*!
+         * @copydoc insert(value_type const&)
+         */
+        std::pair<iterator, bool> insert(value_type&& value)
+        { return try_emplace(std::move(value.first), std::move(value.second)); }
+
+        /*!
+         * @brief Inserts the mapped value constructed from @p args if the key is not present.
+         * @return The position of the element and true if it was inserted.
+         */
+        template<typename K, class... Args>
+        std::pair<iterator, bool> try_emplace(K&& key, Args&& ... args)
+        {
+            auto const index = LowerBoundIndex(key);
+            if (index != size() && !_compare(key, _keys[index])) return { iterator(this, index), false };
+
+            InsertAt(index, std::forward<K>(key), std::forward<Args>(args)...);
+            return { iterator(this, index), true };
+        }
+
+        /*!
+         * @brief Inserts or replaces the mapped value of a key.
+         * @return The position of the element and true if it was inserted.
+         */
+        template<typename K, typename M>
+        std::pair<iterator, bool> insert_or_assign(K&& key, M&& value)
+        {
+            auto const index = LowerBoundIndex(key);
+            if (index != size() && !_compare(key, _keys[index]))
+            {
+                _values[index] = std::forward<M>(value);
+                return { iterator(this, index), false };
+            }
+
+            InsertAt(index, std::forward<K>(key), std::forward<M>(value));
+            return { iterator(this, index), true };
+        }
+
+        /*!
+         * @brief Inserts a range of key-value pairs. Keys already present are kept unchanged.
+         * @details The pairs are appended, sorted and merged with the existing elements: O(n + m log m) instead of O(n * m). If a copy or the
+         * comparison throws, the map is left unchanged (as long as the elements are copyable or nothrow movable).
+         */
+        template<class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            // merge via a permutation so keys and values stay in their separate containers. The existing elements are not touched until
+            // the merged containers are complete, so on an exception only the appended pairs have to be dropped
+            auto const oldSize = size();
+            try
+            {
+                for (; first != last; ++first)
+                {
+                    _keys.push_back(first->first);
+                    _values.push_back(first->second);
+                }
+
+                std::vector<size_type> order(size());
+                std::iota(order.begin(), order.end(), size_type(0));
+
+                auto const byKey = [this](size_type left, size_type right) { return _compare(_keys[left], _keys[right]); };
+                auto const middle = order.begin() + oldSize;
+                std::stable_sort(middle, order.end(), byKey);
+                std::inplace_merge(order.begin(), middle, order.end(), byKey);
+
+                // drop duplicates, keeping the first (existing) occurrence
+                order.erase(std::unique(order.begin(), order.end(), [&byKey](size_type left, size_type right) { return !byKey(left, right); }),
+                            order.end());
+
+                key_container_type    keys;
+                mapped_container_type values;
+                keys.reserve(order.size());
+                values.reserve(order.size());
+                for (auto index : order)
+                {
+                    keys.push_back(std::move_if_noexcept(_keys[index]));
+                    values.push_back(std::move_if_noexcept(_values[index]));
+                }
+
+                _keys   = std::move(keys);
+                _values = std::move(values);
+            }
+            catch (...)
+            {
+                // a failed append may leave keys and values with different sizes
+                _keys.erase(_keys.begin() + oldSize, _keys.end());
+                _values.erase(_values.begin() + oldSize, _values.end());
+                throw;
+            }
+        }
+
+        inline void insert(std::initializer_list<value_type> list)
+        { insert(list.begin(), list.end()); }
+
+        /*!
+         * @brief Erases a key.
+         * @return The number of erased elements (0 or 1).
+         */
+        size_type erase(key_type const& key)
+        {
+            auto it = find(key);
+            if (it == end()) return 0;
+
+            erase(it);
+            return 1;
+        }
+
+        iterator erase(const_iterator position)
+        {
+            _keys.erase(_keys.begin() + position.index());
+            _values.erase(_values.begin() + position.index());
+            return iterator(this, position.index());
+        }
+
+
+        /*!
+         * @brief Gets the mapped value of a key.
+         * @throws out_of_range If the key is not present.
+         */
+        mapped_type& at(key_type const& key)
+        {
+            auto it = find(key);
+            if (it == end()) throw std::out_of_range("Key is not present.");
+            return _values[it.index()];
+        }
+
+        /*!
+         * @copydoc at(key_type const&)
+         */
+        mapped_type const& at(key_type const& key) const
+        {
+            auto it = find(key);
+            if (it == end()) throw std::out_of_range("Key is not present.");
+            return _values[it.index()];
+        }
+
+        /*!
+         * @brief Gets the mapped value of a key, inserting a default constructed value if the key is not present.
+         */
+        mapped_type& operator[](key_type const& key)
+        { return _values[try_emplace(key).first.index()]; }
+
+
+        [[nodiscard]] inline iterator lower_bound(key_type const& key)
+        { return iterator(this, LowerBoundIndex(key)); }
+
+        [[nodiscard]] inline const_iterator lower_bound(key_type const& key) const
+        { return const_iterator(this, LowerBoundIndex(key)); }
+
+        [[nodiscard]] iterator find(key_type const& key)
+        {
+            auto const index = FindIndex(key);
+            return iterator(this, index);
+        }
+
+        [[nodiscard]] const_iterator find(key_type const& key) const
+        {
+            auto const index = FindIndex(key);
+            return const_iterator(this, index);
+        }
+
+        [[nodiscard]] inline bool contains(key_type const& key) const
+        { return FindIndex(key) != size(); }
+
+        [[nodiscard]] inline size_type count(key_type const& key) const
+        { return contains(key) ? 1 : 0; }
+
+        friend void swap(flat_map& left, flat_map& right) noexcept
+        {
+            using std::swap;
+            swap(left._keys, right._keys);
+            swap(left._values, right._values);
+            swap(left._compare, right._compare);
+        }
+
+    private:
+        template<typename K>
+        inline size_type LowerBoundIndex(K const& key) const
+        { return static_cast<size_type>(BranchlessLowerBound(_keys.begin(), _keys.end(), key, _compare) - _keys.begin()); }
+
+        inline size_type FindIndex(key_type const& key) const
+        {
+            auto const index = LowerBoundIndex(key);
+            return (index != size() && !_compare(key, _keys[index])) ? index : size();
+        }
+
+        template<typename K, class... Args>
+        void InsertAt(size_type index, K&& key, Args&& ... args)
+        {
+            _keys.insert(_keys.begin() + index, std::forward<K>(key));
+            try
+            {
+                _values.insert(_values.begin() + index, mapped_type(std::forward<Args>(args)...));
+            }
+            catch (...)
+            {
+                _keys.erase(_keys.begin() + index);
+                throw;
+            }
+        }
+    };
+}
@@ -0,0 +1,262 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 20:15
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <vector>
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <utility>
+
+#include "algorithm/stl_extension/lower_bound.hpp"
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A sorted set stored in a contiguous container.
+     * @details Lookups use BranchlessLowerBound. Single inserts and erases are O(n) (elements are shifted), so bulk insertion via
+     * insert(InputIt, InputIt) is preferred: the new elements are sorted and merged once.
+     *
+     * @tparam Key          The element type.
+     * @tparam Compare      The ordering of the elements.
+     * @tparam Container    The underlying contiguous container.
+     */
+    template<typename Key,
+             class Compare = std::less<Key>,
+             class Container = std::vector<Key>>
+    class flat_set
+    {
+    public:
+        using key_type = Key;
+        using value_type = Key;
+        using key_compare = Compare;
+        using value_compare = Compare;
+        using container_type = Container;
+        using size_type = typename container_type::size_type;
+
+        using reference = value_type const&;
+        using const_reference = value_type const&;
+
+        // elements must not be modified in place, this would break the ordering
+        using iterator = typename container_type::const_iterator;
+        using const_iterator = typename container_type::const_iterator;
+        using reverse_iterator = typename container_type::const_reverse_iterator;
+        using const_reverse_iterator = typename container_type::const_reverse_iterator;
+
+    private:
+        container_type _container;
+        key_compare    _compare;
+
+    public:
+        flat_set() = default;
+
+        explicit flat_set(key_compare const& compare) :
+                _compare(compare)
+        { }
+
+        /*!
+         * @brief Creates a set from an unsorted range. Duplicates are removed.
+         */
+        template<class InputIt>
+        flat_set(InputIt first, InputIt last, key_compare const& compare = key_compare()) :
+                _container(first, last),
+                _compare(compare)
+        { SortAndUnique(); }
+
+        /*!
+         * @brief Creates a set from an unsorted container. Duplicates are removed.
+         */
+        explicit flat_set(container_type container, key_compare const& compare = key_compare()) :
+                _container(std::move(container)),
+                _compare(compare)
+        { SortAndUnique(); }
+
+        flat_set(std::initializer_list<value_type> list, key_compare const& compare = key_compare()) :
+                flat_set(list.begin(), list.end(), compare)
+        { }
+
+
+        [[nodiscard]] inline size_type size() const noexcept
+        { return _container.size(); }
+
+        [[nodiscard]] inline bool empty() const noexcept
+        { return _container.empty(); }
+
+        inline void reserve(size_type size)
+        { _container.reserve(size); }
+
+        inline void clear() noexcept
+        { _container.clear(); }
+
+        /*!
+         * @return The sorted elements.
+         */
+        [[nodiscard]] inline value_type const* data() const noexcept
+        { return _container.data(); }
+
+        /*!
+         * @brief Releases the underlying sorted container.
+         */
+        [[nodiscard]] inline container_type extract()&&
+        { return std::move(_container); }
+
+        [[nodiscard]] inline key_compare key_comp() const
+        { return _compare; }
+
+        inline const_iterator begin() const noexcept
+        { return _container.cbegin(); }
+
+        inline const_iterator end() const noexcept
+        { return _container.cend(); }
+
+        inline const_reverse_iterator rbegin() const noexcept
+        { return _container.crbegin(); }
+
+        inline const_reverse_iterator rend() const noexcept
+        { return _container.crend(); }
+
+
+        /*!
+         * @brief Inserts an element.
+         * @return The position of the element and true if it was inserted.
+         */
+        std::pair<iterator, bool> insert(value_type const& value)
+        { return emplace_hint_helper(lower_bound(value), value); }
+
+        /*!
+         * @copydoc insert(value_type const&)
+         */
+        std::pair<iterator, bool> insert(value_type&& value)
+        { return emplace_hint_helper(lower_bound(value), std::move(value)); }
+
+        /*!
+         * @brief Inserts a range of elements.
+         * @details The new elements are sorted apart from the set, located by a binary search each and merged with the existing elements once:
+         * O(n + m log(n + m)) instead of O(n * m). If a copy or the comparison throws, the set is left unchanged (as long as the elements are
+         * copyable or nothrow movable).
+         */
+        template<class InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            container_type added(first, last);
+            std::sort(added.begin(), added.end(), _compare);
+            Unique(added);
+
+            // every comparison happens before the set is modified: positions[i] is the index the i-th new element is inserted before
+            std::vector<size_type> positions;
+            positions.reserve(added.size());
+
+            size_type count = 0;
+            for (size_type i = 0; i < added.size(); ++i)
+            {
+                auto const position = static_cast<size_type>(lower_bound(added[i]) - begin());
+                if (position != size() && !_compare(added[i], _container[position])) continue;
+
+                if (count != i) added[count] = std::move(added[i]);
+                positions.push_back(position);
+                ++count;
+            }
+            if (count == 0) return;
+
+            container_type merged;
+            merged.reserve(size() + count);
+
+            size_type next = 0;
+            for (size_type i = 0; i < size(); ++i)
+            {
+                for (; next < count && positions[next] == i; ++next) merged.push_back(std::move_if_noexcept(added[next]));
+                merged.push_back(std::move_if_noexcept(_container[i]));
+            }
+            for (; next < count; ++next) merged.push_back(std::move_if_noexcept(added[next]));
+
+            _container = std::move(merged);
+        }
+
+        inline void insert(std::initializer_list<value_type> list)
+        { insert(list.begin(), list.end()); }
+
+        /*!
+         * @brief Erases an element.
+         * @return The number of erased elements (0 or 1).
+         */
+        size_type erase(key_type const& key)
+        {
+            auto it = find(key);
+            if (it == end()) return 0;
+
+            _container.erase(it);
+            return 1;
+        }
+
+        inline iterator erase(const_iterator position)
+        { return _container.erase(position); }
+
+        inline iterator erase(const_iterator first, const_iterator last)
+        { return _container.erase(first, last); }
+
+
+        [[nodiscard]] inline const_iterator lower_bound(key_type const& key) const
+        { return BranchlessLowerBound(_container.cbegin(), _container.cend(), key, _compare); }
+
+        [[nodiscard]] inline const_iterator upper_bound(key_type const& key) const
+        { return std::upper_bound(_container.cbegin(), _container.cend(), key, _compare); }
+
+        [[nodiscard]] const_iterator find(key_type const& key) const
+        {
+            auto it = lower_bound(key);
+            return (it != end() && !_compare(key, *it)) ? it : end();
+        }
+
+        [[nodiscard]] inline bool contains(key_type const& key) const
+        { return find(key) != end(); }
+
+        [[nodiscard]] inline size_type count(key_type const& key) const
+        { return contains(key) ? 1 : 0; }
+
+
+        friend bool operator==(flat_set const& left, flat_set const& right)
+        { return left._container == right._container; }
+
+        friend bool operator!=(flat_set const& left, flat_set const& right)
+        { return !(left == right); }
+
+        friend void swap(flat_set& left, flat_set& right) noexcept
+        {
+            using std::swap;
+            swap(left._container, right._container);
+            swap(left._compare, right._compare);
+        }
+
+    private:
+        template<typename V>
+        std::pair<iterator, bool> emplace_hint_helper(const_iterator position, V&& value)
+        {
+            if (position != end() && !_compare(value, *position)) return { position, false };
+            return { _container.insert(position, std::forward<V>(value)), true };
+        }
+
+        void SortAndUnique()
+        {
+            std::sort(_container.begin(), _container.end(), _compare);
+            Unique(_container);
+        }
+
+        // removes consecutive equivalent elements of a sorted container, keeping the first one
+        void Unique(container_type& container) const
+        {
+            auto const equivalent = [this](value_type const& left, value_type const& right) { return !_compare(left, right); };
+            container.erase(std::unique(container.begin(), container.end(), equivalent), container.end());
+        }
+    };
+}
@@ -17,6 +17,7 @@ namespace HORIZON::ALGORITHM::STL_EXTENSION
 {
     /*!
      * @brief Allows an inherited class to define the shared_from_this interface.
+     * @sa intrusive_ref_counted for objects that are shared on hot paths: its from_this() needs no control block and no pointer cast.
      * @tparam C
      */
     // TODO: make sure C is a valid type
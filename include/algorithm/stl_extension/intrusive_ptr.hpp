@@ -0,0 +1,315 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 23:05
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cassert>
+#include <functional>
+#include <type_traits>
+#include <utility>
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Thread safe reference count policy of intrusive_ref_counted.
+     */
+    class atomic_ref_count
+    {
+    private:
+        std::atomic<std::size_t> _count{ 0 };
+
+    public:
+        inline void Increment() noexcept
+        { _count.fetch_add(1, std::memory_order_relaxed); }
+
+        /*!
+         * @return True if the count dropped to zero. All writes of other owners are then visible.
+         */
+        inline bool Decrement() noexcept
+        { return _count.fetch_sub(1, std::memory_order_acq_rel) == 1; }
+
+        [[nodiscard]] inline std::size_t Count() const noexcept
+        { return _count.load(std::memory_order_relaxed); }
+    };
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Reference count policy of intrusive_ref_counted for objects that are only shared within one thread.
+     */
+    class plain_ref_count
+    {
+    private:
+        std::size_t _count = 0;
+
+    public:
+        inline void Increment() noexcept
+        { ++_count; }
+
+        inline bool Decrement() noexcept
+        { return --_count == 0; }
+
+        [[nodiscard]] inline std::size_t Count() const noexcept
+        { return _count; }
+    };
+
+
+    template<class T>
+    class intrusive_ptr;
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A base class that stores the reference count of an object in the object itself.
+     * @details The intrusive alternative to inheritable_shared_from_this: the object and its count are a single allocation, and from_this()
+     * creates an owning pointer from a plain pointer copy and a count increment, without a control block lookup or a pointer cast.
+     *
+     * Derived classes use the same pattern as with inheritable_shared_from_this: @p C is the class at the root of the hierarchy, and
+     * from_this<Derived>() returns a pointer to a derived class. If objects of derived classes are owned through pointers to @p C, @p C must
+     * have a virtual destructor.
+     *
+     * Copying an object does not copy its count: the copy is a new object without owners.
+     *
+     * @tparam C        The class at the root of the hierarchy, i.e. the class deriving from intrusive_ref_counted.
+     * @tparam Counter  The count policy: atomic_ref_count (default) or plain_ref_count.
+     */
+    template<class C, class Counter = atomic_ref_count>
+    class intrusive_ref_counted
+    {
+        template<class T>
+        friend class intrusive_ptr;
+
+    private:
+        mutable Counter _references;
+
+    protected:
+        intrusive_ref_counted() noexcept = default;
+
+        intrusive_ref_counted(intrusive_ref_counted const&) noexcept
+        { }
+
+        intrusive_ref_counted& operator=(intrusive_ref_counted const&) noexcept
+        { return *this; }
+
+        ~intrusive_ref_counted() = default;
+
+    public:
+        /*!
+         * @brief Creates an owning pointer to this object.
+         * @details The object must already be owned by an intrusive_ptr (e.g. created with make_intrusive). Calling this during construction
+         * or on an object without owners would delete the object when the returned pointer is released.
+         * @tparam D The type of the returned pointer. Must be @p C or a class derived from it.
+         */
+        template<class D = C>
+        inline intrusive_ptr<D> from_this() noexcept
+        {
+            static_assert(std::is_base_of_v<C, D>, "from_this can only return pointers to C or a class derived from C");
+            assert(_references.Count() > 0 && "from_this() called on an object without owners");
+
+            return intrusive_ptr<D>(static_cast<D*>(static_cast<C*>(this)));
+        }
+
+        template<class D = C>
+        inline intrusive_ptr<D const> from_this() const noexcept
+        {
+            static_assert(std::is_base_of_v<C, D>, "from_this can only return pointers to C or a class derived from C");
+            assert(_references.Count() > 0 && "from_this() called on an object without owners");
+
+            return intrusive_ptr<D const>(static_cast<D const*>(static_cast<C const*>(this)));
+        }
+
+        /*!
+         * @return The number of owners. Only a snapshot if the object is shared between threads.
+         */
+        [[nodiscard]] inline std::size_t use_count() const noexcept
+        { return _references.Count(); }
+
+    private:
+        inline void AddReference() const noexcept
+        { _references.Increment(); }
+
+        inline void Release() const noexcept
+        {
+            if (_references.Decrement()) delete static_cast<C const*>(this);
+        }
+    };
+
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A shared pointer to an object deriving from intrusive_ref_counted.
+     * @details Copying increments the count stored in the object, there is no separate control block. The thread safety of copies
+     * is the one of the count policy of the object.
+     *
+     * @tparam T The type of the object.
+     */
+    template<class T>
+    class intrusive_ptr
+    {
+        template<class U>
+        friend class intrusive_ptr;
+
+    public:
+        using element_type = T;
+
+    private:
+        T* _object = nullptr;
+
+    public:
+        constexpr intrusive_ptr() noexcept = default;
+
+        constexpr intrusive_ptr(std::nullptr_t) noexcept
+        { }
+
+        /*!
+         * @brief Takes (shared) ownership of an object.
+         * @param object        The object or nullptr.
+         * @param addReference  False to adopt a reference counted before (@sa detach).
+         */
+        explicit intrusive_ptr(T* object, bool addReference = true) noexcept :
+                _object(object)
+        {
+            if (_object && addReference) _object->AddReference();
+        }
+
+        intrusive_ptr(intrusive_ptr const& other) noexcept :
+                intrusive_ptr(other._object)
+        { }
+
+        intrusive_ptr(intrusive_ptr&& other) noexcept :
+                _object(std::exchange(other._object, nullptr))
+        { }
+
+        template<class U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        intrusive_ptr(intrusive_ptr<U> const& other) noexcept :
+                intrusive_ptr(static_cast<T*>(other._object))
+        { }
+
+        template<class U, typename = std::enable_if_t<std::is_convertible_v<U*, T*>>>
+        intrusive_ptr(intrusive_ptr<U>&& other) noexcept :
+                _object(std::exchange(other._object, nullptr))
+        { }
+
+        ~intrusive_ptr()
+        {
+            if (_object) _object->Release();
+        }
+
+        intrusive_ptr& operator=(intrusive_ptr const& other) noexcept
+        {
+            intrusive_ptr(other).swap(*this);
+            return *this;
+        }
+
+        intrusive_ptr& operator=(intrusive_ptr&& other) noexcept
+        {
+            intrusive_ptr(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        template<class U>
+        intrusive_ptr& operator=(intrusive_ptr<U> const& other) noexcept
+        {
+            intrusive_ptr(other).swap(*this);
+            return *this;
+        }
+
+        template<class U>
+        intrusive_ptr& operator=(intrusive_ptr<U>&& other) noexcept
+        {
+            intrusive_ptr(std::move(other)).swap(*this);
+            return *this;
+        }
+
+        inline void reset() noexcept
+        { intrusive_ptr().swap(*this); }
+
+        inline void reset(T* object) noexcept
+        { intrusive_ptr(object).swap(*this); }
+
+        inline void swap(intrusive_ptr& other) noexcept
+        { std::swap(_object, other._object); }
+
+        /*!
+         * @brief Releases ownership without decrementing the count.
+         * @return The object. The caller is responsible for the reference (e.g. adopt it with intrusive_ptr(object, false)).
+         */
+        [[nodiscard]] inline T* detach() noexcept
+        { return std::exchange(_object, nullptr); }
+
+        [[nodiscard]] inline T* get() const noexcept
+        { return _object; }
+
+        inline T& operator*() const noexcept
+        { return *_object; }
+
+        inline T* operator->() const noexcept
+        { return _object; }
+
+        explicit inline operator bool() const noexcept
+        { return _object != nullptr; }
+
+        [[nodiscard]] inline std::size_t use_count() const noexcept
+        { return _object ? _object->use_count() : 0; }
+    };
+
+    template<class T, class U>
+    inline bool operator==(intrusive_ptr<T> const& lhs, intrusive_ptr<U> const& rhs) noexcept
+    { return lhs.get() == rhs.get(); }
+
+    template<class T, class U>
+    inline bool operator!=(intrusive_ptr<T> const& lhs, intrusive_ptr<U> const& rhs) noexcept
+    { return lhs.get() != rhs.get(); }
+
+    template<class T>
+    inline bool operator==(intrusive_ptr<T> const& lhs, std::nullptr_t) noexcept
+    { return !lhs; }
+
+    template<class T>
+    inline bool operator!=(intrusive_ptr<T> const& lhs, std::nullptr_t) noexcept
+    { return static_cast<bool>(lhs); }
+
+    template<class T, class U>
+    inline bool operator<(intrusive_ptr<T> const& lhs, intrusive_ptr<U> const& rhs) noexcept
+    { return std::less<>()(lhs.get(), rhs.get()); }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Creates an object and an owning pointer to it. One allocation, the count is part of the object.
+     */
+    template<class T, typename... Args>
+    inline intrusive_ptr<T> make_intrusive(Args&& ... args)
+    { return intrusive_ptr<T>(new T(std::forward<Args>(args)...)); }
+
+    template<class T, class U>
+    inline intrusive_ptr<T> static_pointer_cast(intrusive_ptr<U> const& pointer) noexcept
+    { return intrusive_ptr<T>(static_cast<T*>(pointer.get())); }
+
+    template<class T, class U>
+    inline intrusive_ptr<T> dynamic_pointer_cast(intrusive_ptr<U> const& pointer) noexcept
+    { return intrusive_ptr<T>(dynamic_cast<T*>(pointer.get())); }
+}
+
+namespace std
+{
+    template<class T>
+    struct hash<HORIZON::ALGORITHM::STL_EXTENSION::intrusive_ptr<T>>
+    {
+        inline size_t operator()(HORIZON::ALGORITHM::STL_EXTENSION::intrusive_ptr<T> const& pointer) const noexcept
+        { return hash<T*>()(pointer.get()); }
+    };
+}
@@ -0,0 +1,69 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 20:10
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <iterator>
+#include <functional>
+#include <memory>
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A branchless version of std::lower_bound for random access ranges.
+     * @details The search always performs ceil(log2(n)) + 1 comparisons. The only data dependent decision is a select between two pointers, which
+     * compilers turn into a conditional move, so there are no branch mispredictions. Both possible midpoints of the next step are prefetched,
+     * which hides most of the memory latency on large arrays.
+     *
+     * @param first The beginning of the sorted range.
+     * @param last  The end of the sorted range.
+     * @param value The value to search.
+     * @param comp  The comparator the range is sorted by.
+     * @return An iterator to the first element not less than @p value, or @p last.
+     */
+    template<class RandomIt, typename T, class Compare = std::less<>>
+    RandomIt BranchlessLowerBound(RandomIt first, RandomIt last, T const& value, Compare comp = Compare())
+    {
+        auto length = last - first;
+        if (length == 0) return last;
+
+        while (length > 1)
+        {
+            auto const half = length / 2;
+
+#if defined(__GNUC__) || defined(__clang__)
+            __builtin_prefetch(std::addressof(first[half / 2]));
+            __builtin_prefetch(std::addressof(first[half + half / 2]));
+#endif
+
+            first = comp(first[half], value) ? first + half : first;
+            length -= half;
+        }
+
+        return first + static_cast<bool>(comp(*first, value));
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Branchless binary search.
+     * @copydetails BranchlessLowerBound
+     * @return True if an element equivalent to @p value is in the range.
+     */
+    template<class RandomIt, typename T, class Compare = std::less<>>
+    bool BranchlessBinarySearch(RandomIt first, RandomIt last, T const& value, Compare comp = Compare())
+    {
+        auto it = BranchlessLowerBound(first, last, value, comp);
+        return it != last && !comp(value, *it);
+    }
+}
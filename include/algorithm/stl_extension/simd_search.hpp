@@ -0,0 +1,361 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 19:30
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+
+#if (defined(__GNUC__) || defined(__clang__)) && (defined(__x86_64__) || (defined(__i386__) && defined(__SSE2__)))
+#define HORIZON_ALGORITHM_SIMD_X86 1
+#include <immintrin.h>
+#else
+#define HORIZON_ALGORITHM_SIMD_X86 0
+#endif
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION::SIMD
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief True if T can be searched with the vectorised kernels.
+     * @details This is the case if operator== on T is equivalent to a bitwise comparison (integral, enum and pointer types) and the size of T
+     * matches a vector lane. Floating point types are excluded on purpose: NaN != NaN and -0.0 == 0.0 are not bitwise comparisons.
+     */
+    template<typename T>
+    inline constexpr bool IsSearchable = (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                                         (sizeof(T) == 1 || sizeof(T) == 2 || sizeof(T) == 4 || sizeof(T) == 8);
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief The instruction set used by the vectorised kernels.
+     * @details SSE4.1 implies SSSE3. The search kernels only need SSE2, other kernels (e.g. UUID parsing) need the byte shuffles of SSSE3.
+     */
+    enum class SimdLevel
+    {
+        Scalar,
+        SSE2,
+        SSE41,
+        AVX2
+    };
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @return The best instruction set supported by the executing CPU. Detected once.
+     */
+    inline SimdLevel DetectSimdLevel() noexcept
+    {
+#if HORIZON_ALGORITHM_SIMD_X86
+        static SimdLevel const level = []
+        {
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2")) return SimdLevel::AVX2;
+            if (__builtin_cpu_supports("sse4.1")) return SimdLevel::SSE41;
+            return SimdLevel::SSE2;
+        }();
+        return level;
+#else
+        return SimdLevel::Scalar;
+#endif
+    }
+
+    namespace KERNEL
+    {
+        // all kernels work on the unsigned integer of the same size. This makes enums and pointers share the integer kernels.
+        template<std::size_t S>
+        using lane_t = std::conditional_t<S == 1, std::uint8_t,
+                       std::conditional_t<S == 2, std::uint16_t,
+                       std::conditional_t<S == 4, std::uint32_t, std::uint64_t>>>;
+
+        template<typename T>
+        inline lane_t<sizeof(T)> ToLane(T const& value) noexcept
+        {
+            lane_t<sizeof(T)> result;
+            std::memcpy(&result, &value, sizeof(T));
+            return result;
+        }
+
+        // reads an element through memcpy. The array may hold enums or pointers which must not be accessed through an integer lvalue.
+        template<typename U>
+        inline U Load(U const* data, std::size_t index) noexcept
+        {
+            U result;
+            std::memcpy(&result, reinterpret_cast<unsigned char const*>(data) + index * sizeof(U), sizeof(U));
+            return result;
+        }
+
+        template<typename U>
+        std::size_t FindScalar(U const* data, std::size_t size, U value, std::size_t start = 0) noexcept
+        {
+            for (std::size_t i = start; i < size; ++i) { if (Load(data, i) == value) return i; }
+            return size;
+        }
+
+        template<typename U>
+        std::size_t CountScalar(U const* data, std::size_t size, U value, std::size_t start = 0) noexcept
+        {
+            std::size_t result = 0;
+            for (std::size_t i = start; i < size; ++i) { result += Load(data, i) == value; }
+            return result;
+        }
+
+        template<typename U>
+        void FindAllScalar(U const* data, std::size_t size, U value, std::uint64_t* mask, std::size_t start = 0) noexcept
+        {
+            for (std::size_t i = start; i < size; ++i) { mask[i / 64] |= std::uint64_t(Load(data, i) == value) << (i % 64); }
+        }
+
+#if HORIZON_ALGORITHM_SIMD_X86
+        inline int CountBits(std::uint32_t mask) noexcept
+        { return __builtin_popcount(mask); }
+
+        inline int LowestBit(std::uint32_t mask) noexcept
+        { return __builtin_ctz(mask); }
+
+        /*
+         * SSE2: 16 byte vectors. The comparison returns one bit per element.
+         */
+        template<typename U>
+        inline __m128i Broadcast128(U value) noexcept
+        {
+            if constexpr (sizeof(U) == 1) return _mm_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(U) == 2) return _mm_set1_epi16(static_cast<short>(value));
+            else if constexpr (sizeof(U) == 4) return _mm_set1_epi32(static_cast<int>(value));
+            else return _mm_set1_epi64x(static_cast<long long>(value));
+        }
+
+        template<typename U>
+        inline std::uint32_t CompareMask128(__m128i block, __m128i needle) noexcept
+        {
+            if constexpr (sizeof(U) == 1)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, needle)));
+            else if constexpr (sizeof(U) == 2)
+                return static_cast<std::uint32_t>(_mm_movemask_epi8(_mm_packs_epi16(_mm_cmpeq_epi16(block, needle), _mm_setzero_si128())));
+            else if constexpr (sizeof(U) == 4)
+                return static_cast<std::uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_cmpeq_epi32(block, needle))));
+            else
+            {
+                // SSE2 has no 64 bit compare: both 32 bit halves must match
+                __m128i const halves = _mm_cmpeq_epi32(block, needle);
+                __m128i const both   = _mm_and_si128(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+                return static_cast<std::uint32_t>(_mm_movemask_pd(_mm_castsi128_pd(both)));
+            }
+        }
+
+        template<typename U>
+        std::size_t FindSSE2(U const* data, std::size_t size, U value) noexcept
+        {
+            constexpr std::size_t lanes  = 16 / sizeof(U);
+            __m128i const         needle = Broadcast128(value);
+
+            std::size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                std::uint32_t const mask = CompareMask128<U>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), needle);
+                if (mask) return i + LowestBit(mask);
+            }
+            return FindScalar(data, size, value, i);
+        }
+
+        template<typename U>
+        std::size_t CountSSE2(U const* data, std::size_t size, U value) noexcept
+        {
+            constexpr std::size_t lanes  = 16 / sizeof(U);
+            __m128i const         needle = Broadcast128(value);
+
+            std::size_t result = 0;
+            std::size_t i      = 0;
+            for (; i + lanes <= size; i += lanes)
+                result += CountBits(CompareMask128<U>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), needle));
+
+            return result + CountScalar(data, size, value, i);
+        }
+
+        template<typename U>
+        void FindAllSSE2(U const* data, std::size_t size, U value, std::uint64_t* mask) noexcept
+        {
+            // lanes divides 64, so a block never straddles two mask words
+            constexpr std::size_t lanes  = 16 / sizeof(U);
+            __m128i const         needle = Broadcast128(value);
+
+            std::size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                std::uint64_t const bits = CompareMask128<U>(_mm_loadu_si128(reinterpret_cast<__m128i const*>(data + i)), needle);
+                mask[i / 64] |= bits << (i % 64);
+            }
+            FindAllScalar(data, size, value, mask, i);
+        }
+
+
+        /*
+         * AVX2: 32 byte vectors. Compiled for AVX2 via target attributes and only called after runtime detection.
+         */
+        template<typename U>
+        __attribute__((target("avx2"))) inline __m256i Broadcast256(U value) noexcept
+        {
+            if constexpr (sizeof(U) == 1) return _mm256_set1_epi8(static_cast<char>(value));
+            else if constexpr (sizeof(U) == 2) return _mm256_set1_epi16(static_cast<short>(value));
+            else if constexpr (sizeof(U) == 4) return _mm256_set1_epi32(static_cast<int>(value));
+            else return _mm256_set1_epi64x(static_cast<long long>(value));
+        }
+
+        template<typename U>
+        __attribute__((target("avx2"))) inline std::uint32_t CompareMask256(__m256i block, __m256i needle) noexcept
+        {
+            if constexpr (sizeof(U) == 1)
+                return static_cast<std::uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, needle)));
+            else if constexpr (sizeof(U) == 2)
+            {
+                // packs works per 128 bit lane: bits 0-7 hold the lower, bits 16-23 the upper 8 elements
+                auto const bytes = static_cast<std::uint32_t>(
+                        _mm256_movemask_epi8(_mm256_packs_epi16(_mm256_cmpeq_epi16(block, needle), _mm256_setzero_si256())));
+                return (bytes & 0xFFu) | ((bytes >> 8) & 0xFF00u);
+            }
+            else if constexpr (sizeof(U) == 4)
+                return static_cast<std::uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_cmpeq_epi32(block, needle))));
+            else
+                return static_cast<std::uint32_t>(_mm256_movemask_pd(_mm256_castsi256_pd(_mm256_cmpeq_epi64(block, needle))));
+        }
+
+        template<typename U>
+        __attribute__((target("avx2"))) std::size_t FindAVX2(U const* data, std::size_t size, U value) noexcept
+        {
+            constexpr std::size_t lanes  = 32 / sizeof(U);
+            __m256i const         needle = Broadcast256(value);
+
+            std::size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                std::uint32_t const mask = CompareMask256<U>(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + i)), needle);
+                if (mask) return i + LowestBit(mask);
+            }
+            return FindScalar(data, size, value, i);
+        }
+
+        template<typename U>
+        __attribute__((target("avx2"))) std::size_t CountAVX2(U const* data, std::size_t size, U value) noexcept
+        {
+            constexpr std::size_t lanes  = 32 / sizeof(U);
+            __m256i const         needle = Broadcast256(value);
+
+            std::size_t result = 0;
+            std::size_t i      = 0;
+            for (; i + lanes <= size; i += lanes)
+                result += CountBits(CompareMask256<U>(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + i)), needle));
+
+            return result + CountScalar(data, size, value, i);
+        }
+
+        template<typename U>
+        __attribute__((target("avx2"))) void FindAllAVX2(U const* data, std::size_t size, U value, std::uint64_t* mask) noexcept
+        {
+            constexpr std::size_t lanes  = 32 / sizeof(U);
+            __m256i const         needle = Broadcast256(value);
+
+            std::size_t i = 0;
+            for (; i + lanes <= size; i += lanes)
+            {
+                std::uint64_t const bits = CompareMask256<U>(_mm256_loadu_si256(reinterpret_cast<__m256i const*>(data + i)), needle);
+                mask[i / 64] |= bits << (i % 64);
+            }
+            FindAllScalar(data, size, value, mask, i);
+        }
+#endif
+    }
+
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Finds the first occurrence of a value in a contiguous array.
+     * @param data  The array.
+     * @param size  The number of elements.
+     * @param value The value to find.
+     * @return The index of the first occurrence or @p size if the value is not present.
+     */
+    template<typename T, typename = std::enable_if_t<IsSearchable<T>>>
+    std::size_t Find(T const* data, std::size_t size, T const& value) noexcept
+    {
+        using U = KERNEL::lane_t<sizeof(T)>;
+        auto const* lanes = reinterpret_cast<U const*>(data);
+
+#if HORIZON_ALGORITHM_SIMD_X86
+        switch (DetectSimdLevel())
+        {
+            case SimdLevel::AVX2: return KERNEL::FindAVX2(lanes, size, KERNEL::ToLane(value));
+            case SimdLevel::SSE41:
+            case SimdLevel::SSE2: return KERNEL::FindSSE2(lanes, size, KERNEL::ToLane(value));
+            default: break;
+        }
+#endif
+        return KERNEL::FindScalar(lanes, size, KERNEL::ToLane(value));
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Counts the occurrences of a value in a contiguous array.
+     * @param data  The array.
+     * @param size  The number of elements.
+     * @param value The value to count.
+     * @return The number of elements equal to @p value.
+     */
+    template<typename T, typename = std::enable_if_t<IsSearchable<T>>>
+    std::size_t Count(T const* data, std::size_t size, T const& value) noexcept
+    {
+        using U = KERNEL::lane_t<sizeof(T)>;
+        auto const* lanes = reinterpret_cast<U const*>(data);
+
+#if HORIZON_ALGORITHM_SIMD_X86
+        switch (DetectSimdLevel())
+        {
+            case SimdLevel::AVX2: return KERNEL::CountAVX2(lanes, size, KERNEL::ToLane(value));
+            case SimdLevel::SSE41:
+            case SimdLevel::SSE2: return KERNEL::CountSSE2(lanes, size, KERNEL::ToLane(value));
+            default: break;
+        }
+#endif
+        return KERNEL::CountScalar(lanes, size, KERNEL::ToLane(value));
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Marks all occurrences of a value in a contiguous array.
+     * @details Bit i % 64 of mask[i / 64] is set if data[i] equals @p value. Bits are only set, never cleared.
+     * @param data  The array.
+     * @param size  The number of elements.
+     * @param value The value to find.
+     * @param mask  The bit mask. Must hold at least (size + 63) / 64 words.
+     */
+    template<typename T, typename = std::enable_if_t<IsSearchable<T>>>
+    void FindAll(T const* data, std::size_t size, T const& value, std::uint64_t* mask) noexcept
+    {
+        using U = KERNEL::lane_t<sizeof(T)>;
+        auto const* lanes = reinterpret_cast<U const*>(data);
+
+#if HORIZON_ALGORITHM_SIMD_X86
+        switch (DetectSimdLevel())
+        {
+            case SimdLevel::AVX2: return KERNEL::FindAllAVX2(lanes, size, KERNEL::ToLane(value), mask);
+            case SimdLevel::SSE41:
+            case SimdLevel::SSE2: return KERNEL::FindAllSSE2(lanes, size, KERNEL::ToLane(value), mask);
+            default: break;
+        }
+#endif
+        KERNEL::FindAllScalar(lanes, size, KERNEL::ToLane(value), mask);
+    }
+}
@@ -0,0 +1,499 @@
+//
+// @brief   
+// @details 
+// @author  Steffen Peikert (ch3ll)
+// @email   Horizon@ch3ll.com
+// @version 1.0.0
+// @date    18/10/2026 21:05
+// @project Horizon
+//
+
+
+#pragma once
+
+#include <memory>
+#include <iterator>
+#include <algorithm>
+#include <initializer_list>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace HORIZON::ALGORITHM::STL_EXTENSION
+{
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief A vector that stores up to N elements inline and only allocates once it grows beyond N.
+     * @details The interface follows std::vector. Short lists do not touch the heap at all. Once the inline capacity is exceeded, the elements
+     * are moved to storage obtained from the allocator and the vector behaves like std::vector (amortised growth).
+     *
+     * The container also provides pop_front(), so it can be used as the underlying container of std::queue (and thus concurrent_queue). Note
+     * that pop_front() shifts all elements, which is cheap for short lists only.
+     *
+     * @tparam T        The element type.
+     * @tparam N        The number of inline elements.
+     * @tparam Alloc    The allocator used once the inline storage is exceeded.
+     *
+     * @warning Unlike std::vector, moving a small_vector that uses its inline storage moves the elements and invalidates iterators.
+     */
+    template<typename T,
+             std::size_t N,
+             typename Alloc = std::allocator<T>>
+    class small_vector
+    {
+        static_assert(N > 0, "A small_vector requires an inline capacity of at least one element.");
+
+        using alloc_traits = std::allocator_traits<Alloc>;
+
+    public:
+        using value_type = T;
+        using allocator_type = Alloc;
+        using size_type = std::size_t;
+        using difference_type = std::ptrdiff_t;
+        using reference = value_type&;
+        using const_reference = value_type const&;
+        using pointer = value_type*;
+        using const_pointer = value_type const*;
+
+        using iterator = pointer;
+        using const_iterator = const_pointer;
+        using reverse_iterator = std::reverse_iterator<iterator>;
+        using const_reverse_iterator = std::reverse_iterator<const_iterator>;
+
+        /*!
+         * @brief The number of elements stored without allocation.
+         */
+        static constexpr const size_type inline_capacity = N;
+
+    private:
+        // moving from another vector only steals its storage (and never allocates) if the allocators are known to be equal
+        static constexpr const bool IsNothrowMoveAssignable =
+                std::is_nothrow_move_constructible_v<value_type> &&
+                (alloc_traits::propagate_on_container_move_assignment::value || alloc_traits::is_always_equal::value);
+
+        pointer   _data;
+        size_type _size     = 0;
+        size_type _capacity = N;
+
+        allocator_type _allocator;
+
+        alignas(T) unsigned char _buffer[N * sizeof(T)];
+
+    public:
+        small_vector() noexcept(std::is_nothrow_default_constructible_v<allocator_type>) :
+                _data(InlineData())
+        { }
+
+        explicit small_vector(allocator_type const& allocator) noexcept :
+                _data(InlineData()),
+                _allocator(allocator)
+        { }
+
+        explicit small_vector(size_type count, allocator_type const& allocator = allocator_type()) :
+                small_vector(allocator)
+        { resize(count); }
+
+        small_vector(size_type count, value_type const& value, allocator_type const& allocator = allocator_type()) :
+                small_vector(allocator)
+        { resize(count, value); }
+
+        template<class InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        small_vector(InputIt first, InputIt last, allocator_type const& allocator = allocator_type()) :
+                small_vector(allocator)
+        { assign(first, last); }
+
+        small_vector(std::initializer_list<value_type> list, allocator_type const& allocator = allocator_type()) :
+                small_vector(list.begin(), list.end(), allocator)
+        { }
+
+        small_vector(small_vector const& other) :
+                small_vector(alloc_traits::select_on_container_copy_construction(other._allocator))
+        { assign(other.begin(), other.end()); }
+
+        // the allocator is copied, not moved: a copy compares equal to the original, so the storage of other can always be stolen
+        small_vector(small_vector&& other) noexcept(std::is_nothrow_move_constructible_v<value_type> &&
+                                                    std::is_nothrow_copy_constructible_v<allocator_type>) :
+                small_vector(static_cast<allocator_type const&>(other._allocator))
+        { StealOrMove(std::move(other)); }
+
+        ~small_vector()
+        {
+            clear();
+            Deallocate();
+        }
+
+        small_vector& operator=(small_vector const& other)
+        {
+            if (this == &other) return *this;
+
+            if constexpr (alloc_traits::propagate_on_container_copy_assignment::value)
+            {
+                if (_allocator != other._allocator)
+                {
+                    clear();
+                    Deallocate();
+                }
+                _allocator = other._allocator;
+            }
+
+            assign(other.begin(), other.end());
+            return *this;
+        }
+
+        small_vector& operator=(small_vector&& other) noexcept(IsNothrowMoveAssignable)
+        {
+            if (this == &other) return *this;
+
+            clear();
+            Deallocate();
+
+            // copied for the same reason as in the move constructor
+            if constexpr (alloc_traits::propagate_on_container_move_assignment::value)
+                _allocator = other._allocator;
+
+            StealOrMove(std::move(other));
+            return *this;
+        }
+
+        small_vector& operator=(std::initializer_list<value_type> list)
+        {
+            assign(list.begin(), list.end());
+            return *this;
+        }
+
+        template<class InputIt>
+        void assign(InputIt first, InputIt last)
+        {
+            clear();
+            if constexpr (std::is_base_of_v<std::forward_iterator_tag, typename std::iterator_traits<InputIt>::iterator_category>)
+                reserve(static_cast<size_type>(std::distance(first, last)));
+
+            for (; first != last; ++first) emplace_back(*first);
+        }
+
+        [[nodiscard]] inline allocator_type get_allocator() const noexcept
+        { return _allocator; }
+
+
+        [[nodiscard]] inline size_type size() const noexcept
+        { return _size; }
+
+        [[nodiscard]] inline size_type capacity() const noexcept
+        { return _capacity; }
+
+        [[nodiscard]] inline bool empty() const noexcept
+        { return _size == 0; }
+
+        [[nodiscard]] inline size_type max_size() const noexcept
+        { return alloc_traits::max_size(_allocator); }
+
+        /*!
+         * @return True if the elements are stored inline (no heap allocation is owned).
+         */
+        [[nodiscard]] inline bool is_inline() const noexcept
+        { return _data == InlineData(); }
+
+        [[nodiscard]] inline pointer data() noexcept
+        { return _data; }
+
+        [[nodiscard]] inline const_pointer data() const noexcept
+        { return _data; }
+
+
+        inline iterator begin() noexcept
+        { return _data; }
+
+        inline iterator end() noexcept
+        { return _data + _size; }
+
+        inline const_iterator begin() const noexcept
+        { return _data; }
+
+        inline const_iterator end() const noexcept
+        { return _data + _size; }
+
+        inline const_iterator cbegin() const noexcept
+        { return begin(); }
+
+        inline const_iterator cend() const noexcept
+        { return end(); }
+
+        inline reverse_iterator rbegin() noexcept
+        { return reverse_iterator(end()); }
+
+        inline reverse_iterator rend() noexcept
+        { return reverse_iterator(begin()); }
+
+        inline const_reverse_iterator rbegin() const noexcept
+        { return const_reverse_iterator(end()); }
+
+        inline const_reverse_iterator rend() const noexcept
+        { return const_reverse_iterator(begin()); }
+
+
+        inline reference operator[](size_type index) noexcept
+        { return _data[index]; }
+
+        inline const_reference operator[](size_type index) const noexcept
+        { return _data[index]; }
+
+        reference at(size_type index)
+        {
+            if (index >= _size) throw std::out_of_range("Parameter \"index\" is out of bounds.");
+            return _data[index];
+        }
+
+        const_reference at(size_type index) const
+        {
+            if (index >= _size) throw std::out_of_range("Parameter \"index\" is out of bounds.");
+            return _data[index];
+        }
+
+        inline reference front() noexcept
+        { return _data[0]; }
+
+        inline const_reference front() const noexcept
+        { return _data[0]; }
+
+        inline reference back() noexcept
+        { return _data[_size - 1]; }
+
+        inline const_reference back() const noexcept
+        { return _data[_size - 1]; }
+
+
+        /*!
+         * @brief Reserves space for at least @p capacity elements. Allocates if @p capacity exceeds the inline capacity.
+         */
+        void reserve(size_type capacity)
+        {
+            if (capacity <= _capacity) return;
+            Reallocate(capacity);
+        }
+
+        /*!
+         * @brief Moves the elements back into the inline storage if they fit, or shrinks the heap storage to the size.
+         */
+        void shrink_to_fit()
+        {
+            if (is_inline() || _size == _capacity) return;
+            Reallocate(_size);
+        }
+
+        void resize(size_type size)
+        {
+            if (size < _size) Truncate(size);
+            else
+            {
+                reserve(size);
+                while (_size < size) emplace_back();
+            }
+        }
+
+        void resize(size_type size, value_type const& value)
+        {
+            if (size < _size) Truncate(size);
+            else
+            {
+                reserve(size);
+                while (_size < size) emplace_back(value);
+            }
+        }
+
+        inline void clear() noexcept
+        { Truncate(0); }
+
+
+        template<class... Args>
+        reference emplace_back(Args&& ... args)
+        {
+            if (_size == _capacity) return GrowAndEmplaceBack(std::forward<Args>(args)...);
+
+            alloc_traits::construct(_allocator, _data + _size, std::forward<Args>(args)...);
+            return _data[_size++];
+        }
+
+        inline void push_back(value_type const& value)
+        { emplace_back(value); }
+
+        inline void push_back(value_type&& value)
+        { emplace_back(std::move(value)); }
+
+        inline void pop_back() noexcept
+        { alloc_traits::destroy(_allocator, _data + --_size); }
+
+        /*!
+         * @brief Removes the first element.
+         * @note This shifts all remaining elements (O(n)). It exists to make small_vector a valid std::queue container.
+         */
+        inline void pop_front()
+        { erase(begin()); }
+
+        template<class... Args>
+        iterator emplace(const_iterator position, Args&& ... args)
+        {
+            auto const index = static_cast<size_type>(position - begin());
+            emplace_back(std::forward<Args>(args)...);
+            std::rotate(begin() + index, end() - 1, end());
+            return begin() + index;
+        }
+
+        inline iterator insert(const_iterator position, value_type const& value)
+        { return emplace(position, value); }
+
+        inline iterator insert(const_iterator position, value_type&& value)
+        { return emplace(position, std::move(value)); }
+
+        template<class InputIt, typename = typename std::iterator_traits<InputIt>::iterator_category>
+        iterator insert(const_iterator position, InputIt first, InputIt last)
+        {
+            auto const index   = static_cast<size_type>(position - begin());
+            auto const oldSize = _size;
+            for (; first != last; ++first) emplace_back(*first);
+            std::rotate(begin() + index, begin() + oldSize, end());
+            return begin() + index;
+        }
+
+        iterator erase(const_iterator position)
+        { return erase(position, position + 1); }
+
+        iterator erase(const_iterator first, const_iterator last)
+        {
+            auto const index = static_cast<size_type>(first - begin());
+            auto const count = static_cast<size_type>(last - first);
+            if (count == 0) return begin() + index;
+
+            std::move(begin() + index + count, end(), begin() + index);
+            Truncate(_size - count);
+            return begin() + index;
+        }
+
+        friend void swap(small_vector& left, small_vector& right) noexcept(IsNothrowMoveAssignable)
+        {
+            small_vector temp(std::move(left));
+            left  = std::move(right);
+            right = std::move(temp);
+        }
+
+        friend bool operator==(small_vector const& left, small_vector const& right)
+        { return std::equal(left.begin(), left.end(), right.begin(), right.end()); }
+
+        friend bool operator!=(small_vector const& left, small_vector const& right)
+        { return !(left == right); }
+
+        friend bool operator<(small_vector const& left, small_vector const& right)
+        { return std::lexicographical_compare(left.begin(), left.end(), right.begin(), right.end()); }
+
+    private:
+        inline pointer InlineData() noexcept
+        { return std::launder(reinterpret_cast<pointer>(_buffer)); }
+
+        inline const_pointer InlineData() const noexcept
+        { return std::launder(reinterpret_cast<const_pointer>(_buffer)); }
+
+        inline void Truncate(size_type size) noexcept
+        {
+            while (_size > size) pop_back();
+        }
+
+        // releases the heap storage (if any). Elements must already be destroyed.
+        void Deallocate() noexcept
+        {
+            if (!is_inline()) alloc_traits::deallocate(_allocator, _data, _capacity);
+
+            _data     = InlineData();
+            _capacity = N;
+        }
+
+        // moves all elements into a storage of the given capacity (or the inline storage if it fits)
+        void Reallocate(size_type capacity)
+        {
+            bool const toInline = capacity <= N;
+            pointer    storage  = toInline ? InlineData() : alloc_traits::allocate(_allocator, capacity);
+            if (storage == _data) return;
+
+            MoveElements(storage, capacity);
+
+            Deallocate();
+            _data     = storage;
+            _capacity = toInline ? N : capacity;
+        }
+
+        // moves (or copies, if moving may throw) all elements to the new storage and destroys the old ones
+        void MoveElements(pointer storage, size_type capacity)
+        {
+            size_type i = 0;
+            try
+            {
+                for (; i < _size; ++i) alloc_traits::construct(_allocator, storage + i, std::move_if_noexcept(_data[i]));
+            }
+            catch (...)
+            {
+                while (i > 0) alloc_traits::destroy(_allocator, storage + --i);
+                if (storage != InlineData()) alloc_traits::deallocate(_allocator, storage, capacity);
+                throw;
+            }
+
+            for (i = 0; i < _size; ++i) alloc_traits::destroy(_allocator, _data + i);
+        }
+
+        template<class... Args>
+        reference GrowAndEmplaceBack(Args&& ... args)
+        {
+            // the new element is constructed before the old ones are moved, since args may refer to an element of this vector
+            size_type const capacity = std::max<size_type>(2 * _capacity, _size + 1);
+            pointer         storage  = alloc_traits::allocate(_allocator, capacity);
+
+            try
+            {
+                alloc_traits::construct(_allocator, storage + _size, std::forward<Args>(args)...);
+            }
+            catch (...)
+            {
+                alloc_traits::deallocate(_allocator, storage, capacity);
+                throw;
+            }
+
+            size_type i = 0;
+            try
+            {
+                for (; i < _size; ++i) alloc_traits::construct(_allocator, storage + i, std::move_if_noexcept(_data[i]));
+            }
+            catch (...)
+            {
+                alloc_traits::destroy(_allocator, storage + _size);
+                while (i > 0) alloc_traits::destroy(_allocator, storage + --i);
+                alloc_traits::deallocate(_allocator, storage, capacity);
+                throw;
+            }
+
+            for (i = 0; i < _size; ++i) alloc_traits::destroy(_allocator, _data + i);
+
+            Deallocate();
+            _data     = storage;
+            _capacity = capacity;
+            return _data[_size++];
+        }
+
+        // takes over the heap storage of other if allowed, otherwise moves the elements. This object must be empty and inline.
+        void StealOrMove(small_vector&& other)
+        {
+            if (!other.is_inline() && (alloc_traits::is_always_equal::value || _allocator == other._allocator))
+            {
+                _data     = other._data;
+                _size     = other._size;
+                _capacity = other._capacity;
+
+                other._data     = other.InlineData();
+                other._size     = 0;
+                other._capacity = N;
+                return;
+            }
+
+            reserve(other._size);
+            for (auto& item : other) emplace_back(std::move(item));
+            other.clear();
+        }
+    };
+}
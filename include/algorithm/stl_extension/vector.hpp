@@ -13,13 +13,57 @@
 
 #include <vector>
 #include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <type_traits>
+
+#include "algorithm/stl_extension/simd_search.hpp"
 
 namespace HORIZON::ALGORITHM::STL_EXTENSION
 {
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief True if searching @p El in @p Container can use the vectorised kernels of SIMD::Find.
+     * @details The container must store its elements contiguously (provide data() and size()) and the element type must be the value type of the
+     * container and trivially comparable (@sa SIMD::IsSearchable).
+     */
+    template<class Container, typename El, typename = void>
+    inline constexpr bool IsVectorisedSearch = false;
+
+    template<class Container, typename El>
+    inline constexpr bool IsVectorisedSearch<Container, El,
+                                             std::void_t<decltype(std::declval<Container const&>().data()),
+                                                         decltype(std::declval<Container const&>().size())>> =
+            std::is_same_v<El, typename Container::value_type> &&
+            std::is_same_v<decltype(std::declval<Container const&>().data()), El const*> &&
+            SIMD::IsSearchable<El>;
+
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief True if @p Container is an associative container with a (logarithmic or hashed) contains(El) lookup and an erase(El) by key, e.g.
+     * flat_set, flat_map or C++20 associative containers.
+     * @details Requiring key_type and an erase by key that returns the number of erased elements excludes sequences with an unrelated
+     * contains(), like the C++23 std::string::contains(char) (whose erase(size_type) erases a suffix).
+     */
+    template<class Container, typename El, typename = void>
+    inline constexpr bool IsKeyedSearch = false;
+
+    template<class Container, typename El>
+    inline constexpr bool IsKeyedSearch<Container, El, std::void_t<typename Container::key_type,
+                                                                   decltype(std::declval<Container const&>().contains(std::declval<El const&>())),
+                                                                   decltype(std::declval<Container&>().erase(std::declval<El const&>()))>> =
+            std::is_same_v<decltype(std::declval<Container&>().erase(std::declval<El const&>())), typename Container::size_type>;
+
+
     /*!
      * @ingroup group_algorithm_stl
      *
      * @brief Returns true if an item is present in a container.
+     * @details Containers with a contains() member (flat_set, flat_map, ...) are searched with it.
+     * Contiguous containers of integral, enum or pointer types are searched with SSE2/AVX2 (selected at runtime).
      *
      * @param container The container to search.
      * @param element   The element to find.
@@ -28,7 +72,67 @@ namespace HORIZON::ALGORITHM::STL_EXTENSION
     template<class Container,
              typename El = typename Container::value_type>
     inline bool HasItem(Container const& container, El const& element)
-    { return std::find(container.begin(), container.end(), element) != container.end(); }
+    {
+        if constexpr (IsKeyedSearch<Container, El>)
+            return container.contains(element);
+        else if constexpr (IsVectorisedSearch<Container, El>)
+            return SIMD::Find(container.data(), container.size(), element) != container.size();
+        else
+            return std::find(container.begin(), container.end(), element) != container.end();
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Counts the occurrences of an item in a container.
+     * @details Uses the same vectorised kernels as HasItem(Container const&, El const&) if possible.
+     *
+     * @param container The container to search.
+     * @param element   The element to count.
+     * @return          The number of elements equal to @p element.
+     */
+    template<class Container,
+             typename El = typename Container::value_type>
+    inline std::size_t CountItem(Container const& container, El const& element)
+    {
+        if constexpr (IsVectorisedSearch<Container, El>)
+            return SIMD::Count(container.data(), container.size(), element);
+        else
+            return static_cast<std::size_t>(std::count(container.begin(), container.end(), element));
+    }
+
+    /*!
+     * @ingroup group_algorithm_stl
+     *
+     * @brief Finds all occurrences of an item in a container.
+     * @details Returns an index bit mask: Bit i % 64 of word i / 64 is set if the i-th element of the container equals @p element.
+     * Uses the same vectorised kernels as HasItem(Container const&, El const&) if possible.
+     *
+     * @param container The container to search.
+     * @param element   The element to find.
+     * @return          The index bit mask with (container.size() + 63) / 64 words.
+     */
+    template<class Container,
+             typename El = typename Container::value_type>
+    inline std::vector<std::uint64_t> FindAll(Container const& container, El const& element)
+    {
+        std::size_t const          size = std::size(container);
+        std::vector<std::uint64_t> mask((size + 63) / 64, 0);
+
+        if constexpr (IsVectorisedSearch<Container, El>)
+            SIMD::FindAll(container.data(), size, element, mask.data());
+        else
+        {
+            std::size_t index = 0;
+            for (auto const& item : container)
+            {
+                if (item == element) mask[index / 64] |= std::uint64_t(1) << (index % 64);
+                ++index;
+            }
+        }
+
+        return mask;
+    }
 
     /*!
      * @ingroup group_algorithm_stl
@@ -55,26 +159,36 @@ namespace HORIZON::ALGORITHM::STL_EXTENSION
      * @ingroup group_algorithm_stl
      * @brief Removes an item from a container.
      *
-     * @details Erases an item from a container if the item is present.
+     * @details Erases the first occurrence of an item from a container if the item is present. Containers with a contains() member erase by key.
      * Returns true on a successful removal.
      *
-     * @param container
-     * @param element
-     * @return
+     * @param container The container to modify.
+     * @param element   The element to remove.
+     * @return          True if the element was removed.
      */
     template<class Container,
              typename El = typename Container::value_type,
              typename It = typename Container::iterator>
     inline bool EraseItem(Container& container, El const& element)
     {
-        It iterator;
+        if constexpr (IsKeyedSearch<Container, El>)
+            return container.erase(element) > 0;
+        else
+        {
+            It iterator;
+
+            // find the position of the element. This requires an equals operation defined on the element
+            if constexpr (IsVectorisedSearch<Container, El>)
+                iterator = container.begin() + SIMD::Find(container.data(), container.size(), element);
+            else
+                iterator = std::find(container.begin(), container.end(), element);
 
-        // find the position of the element. This requires an equals operation defined on the element
-        if (!IsItemInVector(container, element, iterator)) return false;
+            if (iterator == container.end()) return false;
 
-        // iterator points to the element
-        // this modifies the iterator
-        container.erase(iterator);
-        return true;
+            // iterator points to the element
+            // this modifies the iterator
+            container.erase(iterator);
+            return true;
+        }
     }
 }
\ No newline at end of file